@@ -17,6 +17,252 @@ Notes:
 *********************************************************************/
 
 #include "AirshipOrderList.hpp"
+#include "ListInstrumentation.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    const size_t SCAN_SLOTS = 65536;        // Pool slots one scan task checks
+    const size_t DISPLAY_RUN = 4096;        // Deliveries one display task formats
+    const size_t DISPLAY_RUNS_PER_THREAD = 4;   // Runs formatted per thread before writing
+    const size_t SORT_LEAF = 65536;         // Entries one task sorts before merging starts
+    const size_t MERGE_GRAIN = 65536;       // Merges smaller than this stay on one thread
+
+    typedef std::pair<std::string_view, std::string_view> DeliveryKey;   // (customer, item) lookup key
+
+    struct DeliveryKeyHash
+    {
+        size_t operator()(const DeliveryKey& key) const
+        {
+            size_t iHash = std::hash<std::string_view>()(key.first);
+            return iHash ^ (std::hash<std::string_view>()(key.second) + 0x9e3779b97f4a7c15ULL + (iHash << 6) + (iHash >> 2));
+        }
+    };
+
+    /*********************************************************************
+    bool isValidDelivery(const Delivery& delivery)
+    Purpose:
+        Applies the checks the order entry screens make.
+    *********************************************************************/
+    bool isValidDelivery(const Delivery& delivery)
+    {
+        return !delivery.szName.empty() && !delivery.szItem.empty() && delivery.iQuantity > 0
+            && delivery.cost >= Credits();
+    }
+
+    /*********************************************************************
+    Struct Name: SortEntry
+    Purpose:
+        A node with its sort key packed into WORDS words and its list
+        position, so most comparisons never touch the node.
+    *********************************************************************/
+    template<size_t WORDS>
+    struct SortEntry
+    {
+        uint64_t keyWords[WORDS];   // Key, most significant word first
+        Delivery* pNode;            // The node
+        uint32_t iSequence;         // The node's iSequence, breaks ties
+    };
+
+    const size_t TEXT_KEY_WORDS = 4;   // Inline text plus a length byte
+    const size_t TEXT_KEY_CHARS = TEXT_KEY_WORDS * sizeof(uint64_t) - 1;
+
+    /*********************************************************************
+    void packKey(const Delivery& delivery, DeliverySortKey key, uint64_t* pWords, size_t iWords)
+    Purpose:
+        Packs a key so that unsigned order of the words matches the
+        key's order. Text is stored big-endian, zero-padded, with its
+        length capped at TEXT_KEY_CHARS + 1 in the last byte; a cost is
+        its cents with the sign bit flipped.
+    *********************************************************************/
+    void packKey(const Delivery& delivery, DeliverySortKey key, uint64_t* pWords, size_t iWords)
+    {
+        const uint64_t SIGN_BIT = 1ULL << 63;
+        if(key == DeliverySortKey::Cost)
+        {
+            pWords[0] = static_cast<uint64_t>(delivery.cost.cents()) ^ SIGN_BIT;
+            return;
+        }
+
+        std::string_view szText = (key == DeliverySortKey::Customer) ? delivery.szName.view() : delivery.szItem.view();
+        unsigned char bytes[TEXT_KEY_WORDS * sizeof(uint64_t)] = {};
+        size_t iLastByte = iWords * sizeof(uint64_t) - 1;
+        std::memcpy(bytes, szText.data(), std::min(szText.size(), iLastByte));
+        bytes[iLastByte] = static_cast<unsigned char>(std::min(szText.size(), iLastByte + 1));
+        for(size_t iWord = 0; iWord < iWords; iWord++)
+        {
+            uint64_t iWordValue;
+            std::memcpy(&iWordValue, bytes + iWord * sizeof(uint64_t), sizeof(iWordValue));
+            if constexpr(std::endian::native == std::endian::little) iWordValue = __builtin_bswap64(iWordValue);
+            pWords[iWord] = iWordValue;
+        }
+    }
+
+    /*********************************************************************
+    Struct Name: EntryLess
+    Purpose:
+        Orders sort entries by key, then by list position. Equal packed
+        text keys only need the nodes when the text was too long to
+        pack whole.
+    *********************************************************************/
+    template<size_t WORDS>
+    struct EntryLess
+    {
+        DeliverySortKey key;   // Field being sorted on
+
+        bool operator()(const SortEntry<WORDS>& left, const SortEntry<WORDS>& right) const
+        {
+            for(size_t iWord = 0; iWord < WORDS; iWord++)
+            {
+                if(left.keyWords[iWord] != right.keyWords[iWord]) return left.keyWords[iWord] < right.keyWords[iWord];
+            }
+            if(key != DeliverySortKey::Cost && (left.keyWords[WORDS - 1] & 0xFF) > TEXT_KEY_CHARS)
+            {
+                int iOrder = (key == DeliverySortKey::Customer) ? left.pNode->szName.view().compare(right.pNode->szName.view())
+                                                                : left.pNode->szItem.view().compare(right.pNode->szItem.view());
+                if(iOrder != 0) return iOrder < 0;
+            }
+            return left.iSequence < right.iSequence;
+        }
+    };
+
+    /*********************************************************************
+    void parallelMerge(WorkStealingPool& workPool, const Entry* pLeft, size_t iLeft,
+                       const Entry* pRight, size_t iRight, Entry* pOut, const Less& less)
+    Purpose:
+        Stable merge of two sorted runs, split in halves across the pool
+        until the pieces are small.
+    *********************************************************************/
+    template<typename Entry, typename Less>
+    void parallelMerge(WorkStealingPool& workPool, const Entry* pLeft, size_t iLeft,
+                       const Entry* pRight, size_t iRight, Entry* pOut, const Less& less)
+    {
+        if(iLeft + iRight <= MERGE_GRAIN)
+        {
+            std::merge(pLeft, pLeft + iLeft, pRight, pRight + iRight, pOut, less);
+            return;
+        }
+
+        // Ties between the halves must keep left entries first.
+        size_t iLeftSplit, iRightSplit;
+        if(iLeft >= iRight)
+        {
+            iLeftSplit = iLeft / 2;
+            iRightSplit = std::lower_bound(pRight, pRight + iRight, pLeft[iLeftSplit], less) - pRight;
+        }
+        else
+        {
+            iRightSplit = iRight / 2;
+            iLeftSplit = std::upper_bound(pLeft, pLeft + iLeft, pRight[iRightSplit], less) - pLeft;
+        }
+
+        workPool.parallelFor(2, 1, [&](size_t iBegin, size_t iEnd)
+        {
+            for(size_t iHalf = iBegin; iHalf < iEnd; iHalf++)
+            {
+                if(iHalf == 0)
+                {
+                    parallelMerge(workPool, pLeft, iLeftSplit, pRight, iRightSplit, pOut, less);
+                }
+                else
+                {
+                    parallelMerge(workPool, pLeft + iLeftSplit, iLeft - iLeftSplit, pRight + iRightSplit, iRight - iRightSplit,
+                                  pOut + iLeftSplit + iRightSplit, less);
+                }
+            }
+        });
+    }
+
+    /*********************************************************************
+    void sortNodes(const DeliveryPool& deliveryPool, size_t iCount, DeliverySortKey key,
+                   WorkStealingPool& workPool, Delivery*& pHead, Delivery*& pTail)
+    Purpose:
+        Parallel merge sort of every node in a pool, relinked in place
+        and renumbered. Entries carry WORDS words of key.
+    *********************************************************************/
+    template<size_t WORDS>
+    void sortNodes(const DeliveryPool& deliveryPool, size_t iCount, DeliverySortKey key,
+                   WorkStealingPool& workPool, Delivery*& pHead, Delivery*& pTail)
+    {
+        typedef SortEntry<WORDS> Entry;
+        vector<DeliveryPool::SlotSpan> spans = deliveryPool.spans(SCAN_SLOTS);
+        vector<size_t> firstEntry(spans.size() + 1, 0);
+        workPool.parallelFor(spans.size(), 1, [&](size_t iBegin, size_t iEnd)
+        {
+            for(size_t iSpan = iBegin; iSpan < iEnd; iSpan++)
+            {
+                size_t iLive = 0;
+                for(size_t i = 0; i < spans[iSpan].iSlots; i++) iLive += DeliveryPool::isLive(spans[iSpan].pFirst + i) ? 1 : 0;
+                firstEntry[iSpan + 1] = iLive;
+            }
+        });
+        for(size_t iSpan = 0; iSpan < spans.size(); iSpan++) firstEntry[iSpan + 1] += firstEntry[iSpan];
+
+        std::unique_ptr<Entry[]> entries(new Entry[iCount]);
+        workPool.parallelFor(spans.size(), 1, [&](size_t iBegin, size_t iEnd)
+        {
+            for(size_t iSpan = iBegin; iSpan < iEnd; iSpan++)
+            {
+                Entry* pEntry = entries.get() + firstEntry[iSpan];
+                for(size_t i = 0; i < spans[iSpan].iSlots; i++)
+                {
+                    Delivery* pSlot = const_cast<Delivery*>(spans[iSpan].pFirst + i);
+                    if(!DeliveryPool::isLive(pSlot)) continue;
+                    packKey(*pSlot, key, pEntry->keyWords, WORDS);
+                    pEntry->pNode = pSlot;
+                    pEntry->iSequence = pSlot->iSequence;
+                    pEntry++;
+                }
+            }
+        });
+
+        EntryLess<WORDS> less{ key };
+        size_t iLeaves = (iCount + SORT_LEAF - 1) / SORT_LEAF;
+        workPool.parallelFor(iLeaves, 1, [&](size_t iBegin, size_t iEnd)
+        {
+            for(size_t iLeaf = iBegin; iLeaf < iEnd; iLeaf++)
+            {
+                std::sort(entries.get() + iLeaf * SORT_LEAF, entries.get() + std::min(iCount, (iLeaf + 1) * SORT_LEAF), less);
+            }
+        });
+
+        std::unique_ptr<Entry[]> buffer(new Entry[iLeaves > 1 ? iCount : 0]);
+        Entry* pFrom = entries.get();
+        Entry* pTo = buffer.get();
+        for(size_t iWidth = SORT_LEAF; iWidth < iCount; iWidth *= 2)
+        {
+            size_t iPairs = (iCount + 2 * iWidth - 1) / (2 * iWidth);
+            workPool.parallelFor(iPairs, 1, [&](size_t iBegin, size_t iEnd)
+            {
+                for(size_t iPair = iBegin; iPair < iEnd; iPair++)
+                {
+                    size_t iLeft = iPair * 2 * iWidth;
+                    size_t iMid = std::min(iCount, iLeft + iWidth);
+                    size_t iRight = std::min(iCount, iLeft + 2 * iWidth);
+                    parallelMerge(workPool, pFrom + iLeft, iMid - iLeft, pFrom + iMid, iRight - iMid, pTo + iLeft, less);
+                }
+            });
+            std::swap(pFrom, pTo);
+        }
+
+        workPool.parallelFor(iCount, SORT_LEAF, [&](size_t iBegin, size_t iEnd)
+        {
+            for(size_t i = iBegin; i < iEnd; i++)
+            {
+                pFrom[i].pNode->pNext = (i + 1 < iCount) ? pFrom[i + 1].pNode : nullptr;
+                pFrom[i].pNode->iSequence = static_cast<uint32_t>(i);
+            }
+        });
+        pHead = pFrom[0].pNode;
+        pTail = pFrom[iCount - 1].pNode;
+    }
+}
 
 /*********************************************************************
 AirshipOrderList::AirshipOrderList()
@@ -27,9 +273,9 @@ Parameters:
 Return Value:
     None (constructor)
 Notes:
-    Sets head pointer to nullptr.
+    Sets head and tail pointers to nullptr.
 *********************************************************************/
-AirshipOrderList::AirshipOrderList() : pHead(nullptr) {}
+AirshipOrderList::AirshipOrderList() : pHead(nullptr), pTail(nullptr), iCount(0) {}
 
 /*********************************************************************
 AirshipOrderList::~AirshipOrderList()
@@ -40,50 +286,106 @@ Parameters:
 Return Value:
     None (destructor)
 Notes:
-    Traverses list and deletes each node to prevent memory leaks.
+    Calls clear() to destroy each node before the pool is released.
 *********************************************************************/
 AirshipOrderList::~AirshipOrderList()
 {
+    clear();
+}
+
+/*********************************************************************
+void AirshipOrderList::clear()
+Purpose:
+    Removes every delivery from the list.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Traverses list and returns each node to the pool, which keeps its
+    capacity for reuse.
+*********************************************************************/
+void AirshipOrderList::clear()
+{
+    INSTRUMENT_SCOPE(ListOp::Clear);
     Delivery* current = pHead;
     Delivery* nextNode;
     while(current != nullptr)
     {
+        INSTRUMENT_NODE();
         nextNode = current->pNext;
-        delete current;
+        deliveryPool.destroy(current);
         current = nextNode;
     }
+    pHead = nullptr;
+    pTail = nullptr;
+    iCount = 0;
+    iNextSequence = 0;
+    iRevision++;
 }
 
 /*********************************************************************
-void AirshipOrderList::addDelivery(std::string szCust, std::string szItm, int iQty, double dCst)
+void AirshipOrderList::addDelivery(std::string szCust, std::string szItm, int iQty, Credits cost)
 Purpose:
     Adds a new delivery to the end of the linked list.
 Parameters:
     I std::string szCust - Customer name
     I std::string szItm - Item description
     I int iQty - Quantity of items
-    I double dCst - Cost of delivery
+    I Credits cost - Cost of delivery
 Return Value:
     None
 Notes:
-    Creates new delivery node and appends to end of list.
+    Creates new delivery node and appends it after the tail.
 *********************************************************************/
-void AirshipOrderList::addDelivery(std::string szCust, std::string szItm, int iQty, double dCst)
+void AirshipOrderList::addDelivery(std::string szCust, std::string szItm, int iQty, Credits cost)
 {
-    Delivery* newDelivery = new Delivery(szCust, szItm, iQty, dCst);
+    INSTRUMENT_SCOPE(ListOp::Add);
+    if(iNextSequence == UINT32_MAX) renumber();
+    Delivery* newDelivery = deliveryPool.create(szCust, szItm, iQty, cost);
+    INSTRUMENT_BYTES(newDelivery->szName.heapBytes() + newDelivery->szItem.heapBytes());
+    newDelivery->iSequence = iNextSequence++;
 
     if(pHead == nullptr)
     {
         pHead = newDelivery;
-        return;
     }
+    else
+    {
+        pTail->pNext = newDelivery;
+    }
+    pTail = newDelivery;
+    iCount++;
+    iRevision++;
+}
 
-    Delivery* current = pHead;
-    while(current->pNext != nullptr)
+/*********************************************************************
+void AirshipOrderList::unlinkDelivery(Delivery* prev, Delivery* current)
+Purpose:
+    Unlinks a node from the list and returns it to the pool.
+Parameters:
+    I/O Delivery* prev - Node before current, or nullptr if current is head
+    I/O Delivery* current - Node to remove
+Return Value:
+    None
+Notes:
+    Keeps the tail pointer and count in sync.
+*********************************************************************/
+void AirshipOrderList::unlinkDelivery(Delivery* prev, Delivery* current)
+{
+    if(prev == nullptr)
     {
-        current = current->pNext;
+        pHead = current->pNext;
+    }
+    else
+    {
+        prev->pNext = current->pNext;
     }
-    current->pNext = newDelivery;
+
+    if(pTail == current) pTail = prev;
+    deliveryPool.destroy(current);
+    iCount--;
+    iRevision++;
 }
 
 /*********************************************************************
@@ -96,18 +398,19 @@ Parameters:
 Return Value:
     Delivery* - Pointer to found delivery, or nullptr if not found
 Notes:
-    Searches list for exact match of both name and item.
+    Returns the first exact match of both name and item in list order.
+    The pool's fingerprint table is searched instead of the list: a
+    miss scans one fingerprint per node, and so does a hit once the
+    manifest has been sorted or a freed node reused. Each fingerprint
+    scanned is counted as a node traversed.
 *********************************************************************/
 Delivery* AirshipOrderList::findDelivery(std::string szCust, std::string szItm) const
 {
-    Delivery* current = pHead;
-
-    while(current != nullptr)
-    {
-        if(current->szName == szCust && current->szItem == szItm) return current;
-        current = current->pNext;
-    }
-    return nullptr;
+    INSTRUMENT_SCOPE(ListOp::Find);
+    size_t iScanned = 0;
+    Delivery* delivery = deliveryPool.find(szCust, szItm, &iScanned);
+    INSTRUMENT_NODES(iScanned);
+    return delivery;
 }
 
 /*********************************************************************
@@ -121,57 +424,50 @@ Return Value:
     bool - True if delivery was found and removed, false otherwise
 Notes:
     Searches for delivery and removes it from list, freeing memory.
+    The fingerprint table answers misses without walking the list; a
+    hit walks only as far as the node to find its predecessor. The
+    fingerprints scanned first are counted as nodes traversed.
 *********************************************************************/
 bool AirshipOrderList::removeDelivery(string szCust, string szItm)
 {
-    if(pHead == nullptr) return false;
+    INSTRUMENT_SCOPE(ListOp::Remove);
+    size_t iScanned = 0;
+    Delivery* target = deliveryPool.find(szCust, szItm, &iScanned);
+    INSTRUMENT_NODES(iScanned);
+    if(target == nullptr) return false;
 
-    if(pHead->szName == szCust && pHead->szItem == szItm)
+    Delivery* prev = nullptr;
+    for(Delivery* current = pHead; current != target; current = current->pNext)
     {
-        Delivery* temp = pHead;
-        pHead = pHead->pNext;
-        delete temp;
-        return true;
-    }
-
-    Delivery* prev = pHead;
-    Delivery* current = pHead->pNext;
-
-    while(current != nullptr)
-    {
-        if(current->szName == szCust && current->szItem == szItm)
-        {
-            prev->pNext = current->pNext;
-            delete current;
-            return true;
-        }
+        INSTRUMENT_NODE();
         prev = current;
-        current = current->pNext;
     }
-    return false;
+    unlinkDelivery(prev, target);
+    return true;
 }
 
 /*********************************************************************
-bool AirshipOrderList::modifyDelivery(string szCust, string szItm, int iNewQty, double dNewCst)
+bool AirshipOrderList::modifyDelivery(string szCust, string szItm, int iNewQty, Credits newCost)
 Purpose:
     Modifies the quantity and cost of an existing delivery.
 Parameters:
     I string szCust - Customer name
     I string szItm - Item name
     I int iNewQty - New quantity value
-    I double dNewCst - New cost value
+    I Credits newCost - New cost value
 Return Value:
     bool - True if delivery was found and modified, false otherwise
 Notes:
     Uses findDelivery to locate the delivery before modifying.
 *********************************************************************/
-bool AirshipOrderList::modifyDelivery(string szCust, string szItm, int iNewQty, double dNewCst)
+bool AirshipOrderList::modifyDelivery(string szCust, string szItm, int iNewQty, Credits newCost)
 {
+    INSTRUMENT_SCOPE(ListOp::Modify);
     Delivery* delivery = findDelivery(szCust, szItm);
     if(delivery == nullptr) return false;
 
     delivery->iQuantity = iNewQty;
-    delivery->dCost = dNewCst;
+    delivery->cost = newCost;
 
     return true;
 }
@@ -179,74 +475,518 @@ bool AirshipOrderList::modifyDelivery(string szCust, string szItm, int iNewQty,
 /*********************************************************************
 void AirshipOrderList::displayDeliveries() const
 Purpose:
-    Displays all deliveries in the list.
+    Displays all deliveries in the list on standard output.
 Parameters:
     None
 Return Value:
     None
 Notes:
-    Outputs formatted list of all deliveries with details.
+    Forwards to displayDeliveries(std::cout).
 *********************************************************************/
 void AirshipOrderList::displayDeliveries() const
 {
+    displayDeliveries(std::cout);
+}
+
+/*********************************************************************
+void AirshipOrderList::displayDeliveries(ostream& out) const
+Purpose:
+    Displays all deliveries in the list.
+Parameters:
+    I/O ostream& out - Stream to write the deliveries to
+Return Value:
+    None
+Notes:
+    Outputs formatted list of all deliveries with details.
+*********************************************************************/
+void AirshipOrderList::displayDeliveries(ostream& out) const
+{
+    INSTRUMENT_SCOPE(ListOp::Display);
     Delivery* current = pHead;
     int iCount = 1;
 
     if(current == nullptr)
     {
-        std::cout << "No deliveries to display\n";
+        out << "No deliveries to display\n";
         return;
     }
 
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-    std::cout << szLineSpacing << "               ALL DELIVERIES\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    out << szLineSpacing << "──────────────────────────────────────────────\n";
+    out << szLineSpacing << "               ALL DELIVERIES\n";
+    out << szLineSpacing << "──────────────────────────────────────────────\n\n";
     while(current != nullptr)
     {
-        std::cout << szLineSpacing << "DELIVERY NUMBER: " << iCount << "\n";
-        std::cout << szLineSpacing << "Name: " << current->szName << "\n";
-        std::cout << szLineSpacing << "Item: " << current->szItem << "\n";
-        std::cout << szLineSpacing << "Quantity: " << current->iQuantity << "\n";
-        std::cout << szLineSpacing << "Cost: " << current->dCost << "\n\n";
+        INSTRUMENT_NODE();
+        out << szLineSpacing << "DELIVERY NUMBER: " << iCount << "\n";
+        out << szLineSpacing << "Name: " << current->szName << "\n";
+        out << szLineSpacing << "Item: " << current->szItem << "\n";
+        out << szLineSpacing << "Quantity: " << current->iQuantity << "\n";
+        out << szLineSpacing << "Cost: " << current->cost << "\n\n";
         iCount++;
         current = current->pNext;
     }
 }
 
+/*********************************************************************
+void AirshipOrderList::displayDeliveries(ostream& out, WorkStealingPool& workPool) const
+Purpose:
+    Displays all deliveries in the list, formatting them in parallel.
+Parameters:
+    I/O ostream& out - Stream to write the deliveries to
+    I/O WorkStealingPool& workPool - Threads to format on
+Return Value:
+    None
+Notes:
+    Writes exactly what displayDeliveries(out) writes. One walk marks
+    the start of each run of DISPLAY_RUN deliveries, the runs are
+    formatted with out's flags, then written in list order. A few runs
+    per thread are formatted at a time so the text never piles up.
+*********************************************************************/
+void AirshipOrderList::displayDeliveries(ostream& out, WorkStealingPool& workPool) const
+{
+    INSTRUMENT_SCOPE(ListOp::Display);
+    if(pHead == nullptr)
+    {
+        out << "No deliveries to display\n";
+        return;
+    }
+
+    out << szLineSpacing << "──────────────────────────────────────────────\n";
+    out << szLineSpacing << "               ALL DELIVERIES\n";
+    out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+
+    size_t iWave = workPool.getConcurrency() * DISPLAY_RUNS_PER_THREAD;
+    vector<const Delivery*> runs;
+    vector<string> texts(iWave);
+    const Delivery* current = pHead;
+    size_t iNumber = 1;
+    while(current != nullptr)
+    {
+        runs.clear();
+        while(current != nullptr && runs.size() < iWave)
+        {
+            runs.push_back(current);
+            for(size_t i = 0; i < DISPLAY_RUN && current != nullptr; i++) current = current->pNext;
+        }
+
+        workPool.parallelFor(runs.size(), 1, [&](size_t iBegin, size_t iEnd)
+        {
+            ostringstream text;
+            text.copyfmt(out);
+            for(size_t iRun = iBegin; iRun < iEnd; iRun++)
+            {
+                text.str(string());
+                size_t iRunNumber = iNumber + iRun * DISPLAY_RUN;
+                const Delivery* delivery = runs[iRun];
+                for(size_t i = 0; i < DISPLAY_RUN && delivery != nullptr; i++, delivery = delivery->pNext)
+                {
+                    text << szLineSpacing << "DELIVERY NUMBER: " << iRunNumber + i << "\n";
+                    text << szLineSpacing << "Name: " << delivery->szName << "\n";
+                    text << szLineSpacing << "Item: " << delivery->szItem << "\n";
+                    text << szLineSpacing << "Quantity: " << delivery->iQuantity << "\n";
+                    text << szLineSpacing << "Cost: " << delivery->cost << "\n\n";
+                }
+                texts[iRun] = text.str();
+            }
+        });
+
+        for(size_t iRun = 0; iRun < runs.size(); iRun++) out << texts[iRun];
+        iNumber += runs.size() * DISPLAY_RUN;
+    }
+}
+
+/*********************************************************************
+void AirshipOrderList::sortBy(DeliverySortKey key)
+Purpose:
+    Reorders the manifest by one field on the process-wide pool.
+Parameters:
+    I DeliverySortKey key - Field to order by
+Return Value:
+    None
+Notes:
+    Forwards to sortBy(key, WorkStealingPool::shared()).
+*********************************************************************/
+void AirshipOrderList::sortBy(DeliverySortKey key)
+{
+    sortBy(key, WorkStealingPool::shared());
+}
+
+/*********************************************************************
+void AirshipOrderList::sortBy(DeliverySortKey key, WorkStealingPool& workPool)
+Purpose:
+    Reorders the manifest by one field.
+Parameters:
+    I DeliverySortKey key - Field to order by
+    I/O WorkStealingPool& workPool - Threads to sort on
+Return Value:
+    None
+Notes:
+    Stable, so deliveries with equal keys keep their order. Nodes stay
+    where they are and are relinked in place. Rather than walking the
+    list, one entry per node (packed key, node, iSequence) is taken
+    from a parallel scan of the node pool; iSequence breaks ties.
+    Leaves of SORT_LEAF entries are sorted in parallel, then merged
+    pairwise with parallelMerge() so the last, widest passes still use
+    every thread. Text keys pack TEXT_KEY_CHARS characters, so only
+    longer names and items that tie on them are read from the nodes.
+*********************************************************************/
+void AirshipOrderList::sortBy(DeliverySortKey key, WorkStealingPool& workPool)
+{
+    INSTRUMENT_SCOPE(ListOp::Sort);
+    if(iCount < 2) return;
+
+    if(key == DeliverySortKey::Cost)
+    {
+        sortNodes<1>(deliveryPool, iCount, key, workPool, pHead, pTail);
+    }
+    else
+    {
+        sortNodes<TEXT_KEY_WORDS>(deliveryPool, iCount, key, workPool, pHead, pTail);
+    }
+    deliveryPool.markReordered();
+    iNextSequence = static_cast<uint32_t>(iCount);
+    iRevision++;
+}
+
 /*********************************************************************
 void AirshipOrderList::displayDelivery(const Delivery* delivery)
+Purpose:
+    Displays a single specific delivery on standard output.
+Parameters:
+    I const Delivery* delivery - Pointer to delivery to display
+Return Value:
+    None
+Notes:
+    Forwards to displayDelivery(delivery, std::cout).
+*********************************************************************/
+void AirshipOrderList::displayDelivery(const Delivery* delivery)
+{
+    displayDelivery(delivery, std::cout);
+}
+
+/*********************************************************************
+void AirshipOrderList::displayDelivery(const Delivery* delivery, ostream& out)
 Purpose:
     Displays a single specific delivery.
 Parameters:
     I const Delivery* delivery - Pointer to delivery to display
+    I/O ostream& out - Stream to write the delivery to
 Return Value:
     None
 Notes:
     Searches for delivery matching the provided delivery's name and item.
 *********************************************************************/
-void AirshipOrderList::displayDelivery(const Delivery* delivery)
+void AirshipOrderList::displayDelivery(const Delivery* delivery, ostream& out)
 {
+    INSTRUMENT_SCOPE(ListOp::Display);
     Delivery* current = pHead;
     int iCount = 1;
 
     if(current == nullptr)
     {
-        std::cout << "No deliveries to display\n";
+        out << "No deliveries to display\n";
         return;
     }
 
     while(current != nullptr)
     {
+        INSTRUMENT_NODE();
         if(current->szName == delivery->szName && current->szItem == delivery->szItem)
         {
-            std::cout << szLineSpacing << "DELIVERY NUMBER: " << iCount << "\n";
-            std::cout << szLineSpacing << "Name: " << current->szName << "\n";
-            std::cout << szLineSpacing << "Item: " << current->szItem << "\n";
-            std::cout << szLineSpacing << "Quantity: " << current->iQuantity << "\n";
-            std::cout << szLineSpacing << "Cost: " << current->dCost << "\n";
+            out << szLineSpacing << "DELIVERY NUMBER: " << iCount << "\n";
+            out << szLineSpacing << "Name: " << current->szName << "\n";
+            out << szLineSpacing << "Item: " << current->szItem << "\n";
+            out << szLineSpacing << "Quantity: " << current->iQuantity << "\n";
+            out << szLineSpacing << "Cost: " << current->cost << "\n";
             return;
         }
 
         current = current->pNext;
     }
 }
+
+/*********************************************************************
+void AirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Appends a batch of deliveries in order.
+Parameters:
+    I const vector<DeliveryRecord>& records - Deliveries to append
+Return Value:
+    None
+Notes:
+    Reserves pool capacity for the whole batch first. Appends cannot
+    fail, so no per-record result is returned.
+*********************************************************************/
+void AirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records)
+{
+    INSTRUMENT_SCOPE(ListOp::AddBatch);
+    deliveryPool.reserve(records.size());
+    for(const DeliveryRecord& record : records)
+    {
+        addDelivery(record.szName, record.szItem, record.iQuantity, record.cost);
+    }
+}
+
+/*********************************************************************
+void AirshipOrderList::appendChain(Delivery* pFirst, Delivery* pLast, size_t iDeliveries)
+Purpose:
+    Splices an already linked run of pool nodes onto the tail.
+Parameters:
+    I/O Delivery* pFirst - First node of the run
+    I/O Delivery* pLast - Last node, whose pNext must be nullptr
+    I size_t iDeliveries - Nodes in the run
+Return Value:
+    None
+Notes:
+    The caller has already numbered the run from iNextSequence.
+*********************************************************************/
+void AirshipOrderList::appendChain(Delivery* pFirst, Delivery* pLast, size_t iDeliveries)
+{
+    if(pHead == nullptr)
+    {
+        pHead = pFirst;
+    }
+    else
+    {
+        pTail->pNext = pFirst;
+    }
+    pTail = pLast;
+    iCount += iDeliveries;
+    iNextSequence += static_cast<uint32_t>(iDeliveries);
+    iRevision++;
+}
+
+/*********************************************************************
+void AirshipOrderList::renumber()
+Purpose:
+    Renumbers every node's iSequence from 0 in list order.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Only needed when appends have used up the 32-bit sequence numbers.
+*********************************************************************/
+void AirshipOrderList::renumber()
+{
+    uint32_t iSequence = 0;
+    for(Delivery* current = pHead; current != nullptr; current = current->pNext)
+    {
+        current->iSequence = iSequence++;
+    }
+    iNextSequence = iSequence;
+}
+
+/*********************************************************************
+void AirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records, WorkStealingPool& workPool)
+Purpose:
+    Appends a batch of deliveries in order, building them in parallel.
+Parameters:
+    I const vector<DeliveryRecord>& records - Deliveries to append
+    I/O WorkStealingPool& workPool - Threads to build on
+Return Value:
+    None
+Notes:
+    Same result as addDeliveries(records).
+*********************************************************************/
+void AirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records, WorkStealingPool& workPool)
+{
+    INSTRUMENT_SCOPE(ListOp::AddBatch);
+    addDeliveries(records.size(), workPool, [&records](size_t i, DeliveryRecord& record) { record = records[i]; });
+}
+
+/*********************************************************************
+size_t AirshipOrderList::countInvalid(WorkStealingPool& workPool) const
+Purpose:
+    Counts deliveries that the order entry screens would have refused.
+Parameters:
+    I/O WorkStealingPool& workPool - Threads to scan on
+Return Value:
+    size_t - Deliveries with an empty name or item, a quantity below
+             one, or a negative cost
+Notes:
+    Scans the node pool's slots rather than following the list.
+*********************************************************************/
+size_t AirshipOrderList::countInvalid(WorkStealingPool& workPool) const
+{
+    INSTRUMENT_SCOPE(ListOp::Validate);
+    vector<DeliveryPool::SlotSpan> spans = deliveryPool.spans(SCAN_SLOTS);
+    vector<size_t> invalid(spans.size(), 0);
+    workPool.parallelFor(spans.size(), 1, [&](size_t iBegin, size_t iEnd)
+    {
+        for(size_t iSpan = iBegin; iSpan < iEnd; iSpan++)
+        {
+            size_t iInvalid = 0;
+            for(const Delivery* pSlot = spans[iSpan].pFirst; pSlot != spans[iSpan].pFirst + spans[iSpan].iSlots; pSlot++)
+            {
+                if(DeliveryPool::isLive(pSlot) && !isValidDelivery(*pSlot)) iInvalid++;
+            }
+            invalid[iSpan] = iInvalid;
+        }
+    });
+
+    size_t iInvalid = 0;
+    for(size_t iSpanInvalid : invalid) iInvalid += iSpanInvalid;
+    return iInvalid;
+}
+
+/*********************************************************************
+ManifestTotals AirshipOrderList::totals(WorkStealingPool& workPool) const
+Purpose:
+    Sums deliveries, units and cost over the whole manifest.
+Parameters:
+    I/O WorkStealingPool& workPool - Threads to scan on
+Return Value:
+    ManifestTotals - The sums
+Notes:
+    Scans the node pool's slots rather than following the list. Each
+    span is summed alone and the spans are combined; Credits add
+    exactly, so the cost total is the same on any number of threads.
+*********************************************************************/
+ManifestTotals AirshipOrderList::totals(WorkStealingPool& workPool) const
+{
+    INSTRUMENT_SCOPE(ListOp::Totals);
+    vector<DeliveryPool::SlotSpan> spans = deliveryPool.spans(SCAN_SLOTS);
+    vector<ManifestTotals> partials(spans.size());
+    workPool.parallelFor(spans.size(), 1, [&](size_t iBegin, size_t iEnd)
+    {
+        for(size_t iSpan = iBegin; iSpan < iEnd; iSpan++)
+        {
+            ManifestTotals partial;
+            for(const Delivery* pSlot = spans[iSpan].pFirst; pSlot != spans[iSpan].pFirst + spans[iSpan].iSlots; pSlot++)
+            {
+                if(!DeliveryPool::isLive(pSlot)) continue;
+                partial.iDeliveries++;
+                partial.iUnits += pSlot->iQuantity;
+                partial.cost += pSlot->cost;
+                partial.largestCost = std::max(partial.largestCost, pSlot->cost);
+            }
+            partials[iSpan] = partial;
+        }
+    });
+
+    ManifestTotals result;
+    for(const ManifestTotals& partial : partials)
+    {
+        result.iDeliveries += partial.iDeliveries;
+        result.iUnits += partial.iUnits;
+        result.cost += partial.cost;
+        result.largestCost = std::max(result.largestCost, partial.largestCost);
+    }
+    return result;
+}
+
+/*********************************************************************
+vector<bool> AirshipOrderList::removeDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Removes a batch of deliveries in a single pass over the list.
+Parameters:
+    I const vector<DeliveryRecord>& records - Name/item of each delivery to remove
+Return Value:
+    vector<bool> - One entry per record, true if that record removed a node
+Notes:
+    Gives the same result as calling removeDelivery once per record:
+    repeated keys remove that many matching nodes, earliest first.
+    The walk stops as soon as every record has been satisfied.
+*********************************************************************/
+vector<bool> AirshipOrderList::removeDeliveries(const vector<DeliveryRecord>& records)
+{
+    INSTRUMENT_SCOPE(ListOp::RemoveBatch);
+    vector<bool> results(records.size(), false);
+    std::unordered_map<DeliveryKey, vector<size_t>, DeliveryKeyHash> pending;
+    pending.reserve(records.size());
+
+    for(size_t i = records.size(); i-- > 0;)
+    {
+        pending[DeliveryKey(records[i].szName, records[i].szItem)].push_back(i);
+    }
+
+    size_t iRemaining = records.size();
+    Delivery* prev = nullptr;
+    Delivery* current = pHead;
+
+    while(current != nullptr && iRemaining > 0)
+    {
+        INSTRUMENT_NODE();
+        Delivery* next = current->pNext;
+        auto match = pending.find(DeliveryKey(current->szName, current->szItem));
+        if(match != pending.end() && !match->second.empty())
+        {
+            results[match->second.back()] = true;
+            match->second.pop_back();
+            iRemaining--;
+            unlinkDelivery(prev, current);
+        }
+        else
+        {
+            prev = current;
+        }
+        current = next;
+    }
+    return results;
+}
+
+/*********************************************************************
+vector<bool> AirshipOrderList::modifyDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Modifies a batch of deliveries in a single pass over the list.
+Parameters:
+    I const vector<DeliveryRecord>& records - Name/item plus new quantity and cost
+Return Value:
+    vector<bool> - One entry per record, true if its delivery was found
+Notes:
+    Gives the same result as calling modifyDelivery once per record:
+    only the first matching node changes and the last record for a
+    key wins.
+*********************************************************************/
+vector<bool> AirshipOrderList::modifyDeliveries(const vector<DeliveryRecord>& records)
+{
+    INSTRUMENT_SCOPE(ListOp::ModifyBatch);
+    vector<bool> results(records.size(), false);
+    std::unordered_map<DeliveryKey, vector<size_t>, DeliveryKeyHash> pending;
+    pending.reserve(records.size());
+
+    for(size_t i = 0; i < records.size(); i++)
+    {
+        pending[DeliveryKey(records[i].szName, records[i].szItem)].push_back(i);
+    }
+
+    Delivery* current = pHead;
+    while(current != nullptr && !pending.empty())
+    {
+        INSTRUMENT_NODE();
+        auto match = pending.find(DeliveryKey(current->szName, current->szItem));
+        if(match != pending.end())
+        {
+            const DeliveryRecord& last = records[match->second.back()];
+            current->iQuantity = last.iQuantity;
+            current->cost = last.cost;
+            for(size_t i : match->second) results[i] = true;
+            pending.erase(match);
+        }
+        current = current->pNext;
+    }
+    return results;
+}
+
+/*********************************************************************
+size_t AirshipOrderList::footprintBytes() const
+Purpose:
+    Memory held by the list.
+Parameters:
+    None
+Return Value:
+    size_t - The list object, every pool chunk and the heap text of
+             each delivery
+Notes:
+    Free pool slots count too, since the pool never returns them.
+*********************************************************************/
+size_t AirshipOrderList::footprintBytes() const
+{
+    size_t iBytes = sizeof(*this) + deliveryPool.footprintBytes();
+    for(const Delivery* current = pHead; current != nullptr; current = current->pNext)
+    {
+        iBytes += current->szName.heapBytes() + current->szItem.heapBytes();
+    }
+    return iBytes;
+}
@@ -1,18 +1,37 @@
 #pragma once
-#include <iostream>
-#include <iomanip>
-using namespace std;
+#include "Delivery.hpp"
+#include "DeliveryPool.hpp"
+#include "WorkStealingPool.hpp"
+#include <cstdint>
+#include <vector>
 
-struct Delivery 
+/*********************************************************************
+Enum Name: DeliverySortKey
+Purpose:
+    Field AirshipOrderList::sortBy() orders the manifest by.
+Notes:
+    None
+*********************************************************************/
+enum class DeliverySortKey : uint8_t
+{
+    Customer,   // Name, byte order
+    Item,       // Item, byte order
+    Cost        // Total cost, cheapest first
+};
+
+/*********************************************************************
+Struct Name: ManifestTotals
+Purpose:
+    Sums over every delivery in a manifest.
+Notes:
+    None
+*********************************************************************/
+struct ManifestTotals
 {
-    string szName;          // Name of the customer
-    string szItem;          // Item purchased
-    int iQuantity;          // How many items were purchased
-    double dCost;           // Total cost of delivery
-    Delivery* pNext = nullptr; // Next delivery
-
-    Delivery(string szN, string szI, int iQ, double dC) :
-        szName(szN), szItem(szI), iQuantity(iQ), dCost(dC){}
+    size_t iDeliveries = 0;     // Deliveries counted
+    long long iUnits = 0;       // Sum of quantities
+    Credits cost;               // Sum of costs
+    Credits largestCost;        // Most expensive single delivery
 };
 
 /*********************************************************************
@@ -21,21 +40,100 @@ Purpose:
     Linked List of Airship Orders
 Notes:
     This is used for managing a series of airship deliveries.
+    Nodes live in a DeliveryPool and a tail pointer keeps appends O(1).
+    Bulk operations that take a WorkStealingPool split their work
+    across it: loads build nodes in one block, order-free scans walk
+    the node pool's slots, and display formats runs of the list.
+    getRevision() changes whenever deliveries are added, removed or
+    reordered, so snapshots such as DeliverySearchIndex can tell they
+    are stale.
+    Built with AIRSHIP_INSTRUMENT, every operation reports to
+    ListInstrumentation::global().
 *********************************************************************/
 class AirshipOrderList
 {
     private:
         Delivery* pHead;
+        Delivery* pTail;
+        size_t iCount;
+        uint32_t iNextSequence = 0;
+        size_t iRevision = 0;
+        DeliveryPool deliveryPool;
         const char* szLineSpacing = "";
 
+        void unlinkDelivery(Delivery* prev, Delivery* current);
+        void appendChain(Delivery* pFirst, Delivery* pLast, size_t iDeliveries);
+        void renumber();
+
     public:
         AirshipOrderList();
         ~AirshipOrderList();
+        AirshipOrderList(const AirshipOrderList&) = delete;
+        AirshipOrderList& operator=(const AirshipOrderList&) = delete;
 
-        void addDelivery(string szCust, string szItm, int iQty, double dCst);
+        void addDelivery(string szCust, string szItm, int iQty, Credits cost);
         bool removeDelivery(string szCust, string szItm);
         Delivery* findDelivery(string szCust, string szItm) const;
-        bool modifyDelivery(string szCust, string szItm, int iNewQty, double dNewCst);
+        bool modifyDelivery(string szCust, string szItm, int iNewQty, Credits newCost);
         void displayDeliveries() const;
+        void displayDeliveries(ostream& out) const;
         void displayDelivery(const Delivery* delivery);
+        void displayDelivery(const Delivery* delivery, ostream& out);
+
+        void addDeliveries(const vector<DeliveryRecord>& records);
+        vector<bool> removeDeliveries(const vector<DeliveryRecord>& records);
+        vector<bool> modifyDeliveries(const vector<DeliveryRecord>& records);
+
+        template<typename Make>
+        void addDeliveries(size_t iDeliveries, WorkStealingPool& workPool, Make&& make);
+        void addDeliveries(const vector<DeliveryRecord>& records, WorkStealingPool& workPool);
+        size_t countInvalid(WorkStealingPool& workPool) const;
+        ManifestTotals totals(WorkStealingPool& workPool) const;
+        void displayDeliveries(ostream& out, WorkStealingPool& workPool) const;
+        void sortBy(DeliverySortKey key);
+        void sortBy(DeliverySortKey key, WorkStealingPool& workPool);
+        void clear();
+        const Delivery* getHead() const { return pHead; }
+        void reserve(size_t iDeliveries) { deliveryPool.reserve(iDeliveries); }
+        size_t size() const { return iCount; }
+        size_t getRevision() const { return iRevision; }
+        size_t footprintBytes() const;
 };
+
+/*********************************************************************
+void AirshipOrderList::addDeliveries(size_t iDeliveries, WorkStealingPool& workPool, Make&& make)
+Purpose:
+    Appends iDeliveries generated deliveries, building them in parallel.
+Parameters:
+    I size_t iDeliveries - Deliveries to append
+    I/O WorkStealingPool& workPool - Threads to build on
+    I Make&& make - Callable make(size_t i, DeliveryRecord& record) that
+                    fills in delivery i; called from several threads
+Return Value:
+    None
+Notes:
+    Nodes go into one block of adjacent slots and each chunk links its
+    own nodes, so the only serial work is splicing the block on.
+*********************************************************************/
+template<typename Make>
+void AirshipOrderList::addDeliveries(size_t iDeliveries, WorkStealingPool& workPool, Make&& make)
+{
+    const size_t LOAD_GRAIN = 16384;   // Deliveries one task builds
+
+    if(iDeliveries == 0) return;
+    if(iDeliveries > UINT32_MAX - iNextSequence) renumber();
+    uint32_t iFirstSequence = iNextSequence;
+    Delivery* pBlock = deliveryPool.allocateBlock(iDeliveries);
+    workPool.parallelFor(iDeliveries, LOAD_GRAIN, [&](size_t iBegin, size_t iEnd)
+    {
+        DeliveryRecord record;
+        for(size_t i = iBegin; i < iEnd; i++)
+        {
+            make(i, record);
+            Delivery* pNode = deliveryPool.construct(pBlock + i, record.szName, record.szItem, record.iQuantity, record.cost);
+            pNode->pNext = (i + 1 < iDeliveries) ? pBlock + i + 1 : nullptr;
+            pNode->iSequence = iFirstSequence + static_cast<uint32_t>(i);
+        }
+    });
+    appendChain(pBlock, pBlock + iDeliveries - 1, iDeliveries);
+}
@@ -0,0 +1,231 @@
+/*********************************************************************
+File name: BatchSimulator.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the BatchSimulator class.
+Command Parameters:
+    N/A
+Input:
+    A strategy and a number of games.
+Results:
+    Win tallies and throughput.
+Notes:
+    None
+*********************************************************************/
+
+#include "BatchSimulator.hpp"
+#include "AirshipOrderList.hpp"
+#include "DisplayManager.hpp"
+#include "GameManager.hpp"
+#include "OutputSink.hpp"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    const size_t GAMES_PER_CHUNK = 64;     // Games a pool task plays back to back
+    const int RIDDLE_WEIGHT = 2;           // Votes a riddle gives its suspect
+
+    /*********************************************************************
+    const DisplayManager& sharedScenes()
+    Purpose:
+        Scene table shared by every simulated session.
+    *********************************************************************/
+    const DisplayManager& sharedScenes()
+    {
+        static const DisplayManager displayManager;
+        return displayManager;
+    }
+}
+
+/*********************************************************************
+BatchSimulator::BatchSimulator(WorkStealingPool& workPool, size_t iCustomerCount, uint64_t iSeed)
+Purpose:
+    Constructor for a simulator of shifts of one size.
+Parameters:
+    I/O WorkStealingPool& workPool - Threads to play on
+    I size_t iCustomerCount - Customers per shift
+    I uint64_t iSeed - Seed of the first game
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+BatchSimulator::BatchSimulator(WorkStealingPool& workPool, size_t iCustomerCount, uint64_t iSeed) :
+    pool(workPool), iCustomers(iCustomerCount), iBaseSeed(iSeed) {}
+
+/*********************************************************************
+SimulationResult BatchSimulator::run(BotStrategy strategy, size_t iGames) const
+Purpose:
+    Plays a batch of shifts with one strategy.
+Parameters:
+    I BotStrategy strategy - How the bot picks its suspect
+    I size_t iGames - Shifts to play
+Return Value:
+    SimulationResult - Wins, wall time and thread count
+Notes:
+    None
+*********************************************************************/
+SimulationResult BatchSimulator::run(BotStrategy strategy, size_t iGames) const
+{
+    SimulationResult result;
+    result.strategy = strategy;
+    result.iGames = iGames;
+    result.iThreads = pool.getConcurrency();
+
+    std::atomic<size_t> iWins(0);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pool.parallelFor(iGames, GAMES_PER_CHUNK, [&](size_t iBegin, size_t iEnd)
+    {
+        NullSink sink(4096);
+        std::string szScript;
+        size_t iChunkWins = 0;
+        for(size_t iGame = iBegin; iGame < iEnd; iGame++)
+        {
+            iChunkWins += playGame(iBaseSeed + iGame, strategy, sink, szScript) ? 1 : 0;
+        }
+        iWins.fetch_add(iChunkWins, std::memory_order_relaxed);
+    });
+    result.dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.iWins = iWins.load();
+    return result;
+}
+
+/*********************************************************************
+bool BatchSimulator::playGame(uint64_t iSeed, BotStrategy strategy, OutputSink& sink, std::string& szScript) const
+Purpose:
+    Plays one shift from the opening scene to the ending.
+Parameters:
+    I uint64_t iSeed - Scenario seed
+    I BotStrategy strategy - How the bot picks its suspect
+    I/O OutputSink& sink - Receives the game's screens
+    I/O std::string& szScript - Scratch buffer for the player input
+Return Value:
+    bool - True if the bot removed a planted fraud
+Notes:
+    The bot logs every customer exactly as shown, then deletes its
+    suspect from the guessing menu.
+*********************************************************************/
+bool BatchSimulator::playGame(uint64_t iSeed, BotStrategy strategy, OutputSink& sink, std::string& szScript) const
+{
+    ScenarioGenerator scenario(iSeed, iCustomers);
+    ScenarioOrder suspect;
+    scenario.order(chooseSuspect(scenario, strategy), suspect);
+
+    scenario.writeScript(szScript);
+    szScript += "5\n";
+    szScript += suspect.szName;
+    szScript += '\n';
+    szScript += suspect.szItem;
+    szScript += "\ny\n\n";
+
+    AirshipOrderList airshipOrderList;
+    GameManager gameManager(airshipOrderList, sink);
+    gameManager.setScenario(&scenario);
+    gameManager.start(sharedScenes());
+
+    std::string szLine;
+    size_t iPos = 0;
+    while(!gameManager.isFinished() && iPos < szScript.size())
+    {
+        size_t iEnd = szScript.find('\n', iPos);
+        szLine.assign(szScript, iPos, iEnd - iPos);
+        gameManager.step(szLine);
+        iPos = iEnd + 1;
+    }
+    if(!gameManager.isFinished()) gameManager.endOfInput();
+    return gameManager.getIsGuessCorrect();
+}
+
+/*********************************************************************
+size_t BatchSimulator::chooseSuspect(const ScenarioGenerator& scenario, BotStrategy strategy)
+Purpose:
+    Picks the customer a bot will remove.
+Parameters:
+    I const ScenarioGenerator& scenario - Shift being played
+    I BotStrategy strategy - How to pick
+Return Value:
+    size_t - Position of the suspect
+Notes:
+    The clue follower gives each accusation one vote and each riddle
+    RIDDLE_WEIGHT votes for the cheapest per unit shipper of the item
+    it names. Ties go to the earlier customer.
+*********************************************************************/
+size_t BatchSimulator::chooseSuspect(const ScenarioGenerator& scenario, BotStrategy strategy)
+{
+    size_t iCount = scenario.size();
+    if(strategy == BotStrategy::Random)
+    {
+        std::mt19937_64 random(scenario.getSeed());
+        return std::uniform_int_distribution<size_t>(0, iCount - 1)(random);
+    }
+
+    ScenarioOrder current;
+    std::vector<double> unitCosts(iCount);
+    std::vector<std::string_view> items(iCount);
+    std::vector<int> votes(iCount, 0);
+    std::vector<std::string_view> hints;
+    std::string szClues;
+    for(size_t i = 0; i < iCount; i++)
+    {
+        if(strategy == BotStrategy::ClueFollowing)
+        {
+            scenario.profile(i, current, szClues);
+            votes[current.iAccused]++;
+            if(!current.szHintedItem.empty()) hints.push_back(current.szHintedItem);
+        }
+        else
+        {
+            scenario.order(i, current);
+        }
+        unitCosts[i] = current.dCost / current.iQuantity;
+        items[i] = current.szItem;
+    }
+
+    if(strategy == BotStrategy::CheapestPerUnit)
+    {
+        size_t iCheapest = 0;
+        for(size_t i = 1; i < iCount; i++) if(unitCosts[i] < unitCosts[iCheapest]) iCheapest = i;
+        return iCheapest;
+    }
+
+    for(std::string_view szHint : hints)
+    {
+        size_t iCheapest = iCount;
+        for(size_t i = 0; i < iCount; i++)
+        {
+            if(items[i] == szHint && (iCheapest == iCount || unitCosts[i] < unitCosts[iCheapest])) iCheapest = i;
+        }
+        if(iCheapest < iCount) votes[iCheapest] += RIDDLE_WEIGHT;
+    }
+    size_t iSuspect = 0;
+    for(size_t i = 1; i < iCount; i++) if(votes[i] > votes[iSuspect]) iSuspect = i;
+    return iSuspect;
+}
+
+/*********************************************************************
+const char* BatchSimulator::strategyName(BotStrategy strategy)
+Purpose:
+    Printable name of a strategy.
+Parameters:
+    I BotStrategy strategy - Strategy to name
+Return Value:
+    const char* - Name in read-only data
+Notes:
+    None
+*********************************************************************/
+const char* BatchSimulator::strategyName(BotStrategy strategy)
+{
+    switch(strategy)
+    {
+        case BotStrategy::Random: return "random";
+        case BotStrategy::CheapestPerUnit: return "cheapest-per-unit";
+        case BotStrategy::ClueFollowing: return "clue-following";
+    }
+    return "unknown";
+}
@@ -0,0 +1,89 @@
+/*********************************************************************
+File name: BatchSimulator.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the BatchSimulator class, which plays many
+    generated shifts with automated players.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for BatchSimulator, enum definition for
+    BotStrategy and struct definition for SimulationResult.
+Notes:
+    Used for balancing the clues and for capacity planning.
+*********************************************************************/
+
+#pragma once
+#include "ScenarioGenerator.hpp"
+#include "WorkStealingPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class OutputSink;
+
+/*********************************************************************
+Enum Name: BotStrategy
+Purpose:
+    How an automated player picks the package to remove.
+Notes:
+    None
+*********************************************************************/
+enum class BotStrategy : uint8_t
+{
+    Random,            // Any customer
+    CheapestPerUnit,   // Lowest declared cost per unit
+    ClueFollowing      // Most accused, riddles counting double
+};
+
+/*********************************************************************
+Struct Name: SimulationResult
+Purpose:
+    Tally of one batch of simulated shifts.
+Notes:
+    None
+*********************************************************************/
+struct SimulationResult
+{
+    BotStrategy strategy = BotStrategy::Random;   // Strategy played
+    size_t iGames = 0;                            // Shifts played
+    size_t iWins = 0;                             // Shifts where a fraud was removed
+    double dSeconds = 0.0;                        // Wall time for the batch
+    unsigned iThreads = 1;                        // Threads that played
+
+    double winRate() const { return iGames == 0 ? 0.0 : static_cast<double>(iWins) / static_cast<double>(iGames); }
+    double gamesPerSecondPerCore() const { return dSeconds <= 0.0 ? 0.0 : iGames / dSeconds / iThreads; }
+};
+
+/*********************************************************************
+Class Name: BatchSimulator
+Purpose:
+    Plays seeded shifts end to end through GameManager's headless
+    step() path, with a bot choosing which package to remove.
+Notes:
+    Game i of a batch uses seed iBaseSeed + i, so a batch gives the
+    same tallies on any number of threads. Games are sharded across
+    a WorkStealingPool; each chunk keeps its own output sink and
+    scratch buffers. Bots decide from what the player is shown: the
+    logged orders and each customer's accusation and riddle.
+*********************************************************************/
+class BatchSimulator
+{
+    private:
+        WorkStealingPool& pool;   // Threads the games run on
+        size_t iCustomers;        // Customers per shift
+        uint64_t iBaseSeed;       // Seed of game 0
+
+    public:
+        BatchSimulator(WorkStealingPool& workPool, size_t iCustomerCount = 6, uint64_t iSeed = 1);
+
+        SimulationResult run(BotStrategy strategy, size_t iGames) const;
+        bool playGame(uint64_t iSeed, BotStrategy strategy, OutputSink& sink, std::string& szScript) const;
+
+        static size_t chooseSuspect(const ScenarioGenerator& scenario, BotStrategy strategy);
+        static const char* strategyName(BotStrategy strategy);
+};
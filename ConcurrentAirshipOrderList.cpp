@@ -0,0 +1,195 @@
+/*********************************************************************
+File name: ConcurrentAirshipOrderList.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the ConcurrentAirshipOrderList class.
+Command Parameters:
+    N/A
+Input:
+    Delivery information (customer name, item, quantity, cost).
+Results:
+    Thread safe access to a manifest of deliveries.
+Notes:
+    Every method takes listMutex for exactly one list operation.
+*********************************************************************/
+
+#include "ConcurrentAirshipOrderList.hpp"
+#include <mutex>
+#include <sstream>
+
+/*********************************************************************
+void ConcurrentAirshipOrderList::addDelivery(const string& szCust, const string& szItm, int iQty, Credits cost)
+Purpose:
+    Appends a delivery under the exclusive lock.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item description
+    I int iQty - Quantity of items
+    I Credits cost - Cost of delivery
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void ConcurrentAirshipOrderList::addDelivery(const string& szCust, const string& szItm, int iQty, Credits cost)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    orderList.addDelivery(szCust, szItm, iQty, cost);
+}
+
+/*********************************************************************
+bool ConcurrentAirshipOrderList::removeDelivery(const string& szCust, const string& szItm)
+Purpose:
+    Removes a delivery under the exclusive lock.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item name
+Return Value:
+    bool - True if delivery was found and removed, false otherwise
+Notes:
+    None
+*********************************************************************/
+bool ConcurrentAirshipOrderList::removeDelivery(const string& szCust, const string& szItm)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    return orderList.removeDelivery(szCust, szItm);
+}
+
+/*********************************************************************
+bool ConcurrentAirshipOrderList::findDelivery(const string& szCust, const string& szItm, DeliveryRecord& found) const
+Purpose:
+    Looks up a delivery under the shared lock and copies it out.
+Parameters:
+    I const string& szCust - Customer name to search for
+    I const string& szItm - Item name to search for
+    O DeliveryRecord& found - Copy of the delivery when found
+Return Value:
+    bool - True if the delivery was found
+Notes:
+    found is left untouched on a miss.
+*********************************************************************/
+bool ConcurrentAirshipOrderList::findDelivery(const string& szCust, const string& szItm, DeliveryRecord& found) const
+{
+    std::shared_lock<std::shared_mutex> lock(listMutex);
+    const Delivery* delivery = orderList.findDelivery(szCust, szItm);
+    if(delivery == nullptr) return false;
+
+    found.szName = delivery->szName;
+    found.szItem = delivery->szItem;
+    found.iQuantity = delivery->iQuantity;
+    found.cost = delivery->cost;
+    return true;
+}
+
+/*********************************************************************
+bool ConcurrentAirshipOrderList::modifyDelivery(const string& szCust, const string& szItm, int iNewQty, Credits newCost)
+Purpose:
+    Modifies a delivery under the exclusive lock.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item name
+    I int iNewQty - New quantity value
+    I Credits newCost - New cost value
+Return Value:
+    bool - True if delivery was found and modified, false otherwise
+Notes:
+    None
+*********************************************************************/
+bool ConcurrentAirshipOrderList::modifyDelivery(const string& szCust, const string& szItm, int iNewQty, Credits newCost)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    return orderList.modifyDelivery(szCust, szItm, iNewQty, newCost);
+}
+
+/*********************************************************************
+void ConcurrentAirshipOrderList::displayDeliveries(ostream& out) const
+Purpose:
+    Displays all deliveries.
+Parameters:
+    I/O ostream& out - Stream to write the deliveries to
+Return Value:
+    None
+Notes:
+    Formats into a private buffer under the shared lock, then writes
+    the buffer to out with no lock held.
+*********************************************************************/
+void ConcurrentAirshipOrderList::displayDeliveries(ostream& out) const
+{
+    std::ostringstream buffer;
+    buffer.copyfmt(out);
+    {
+        std::shared_lock<std::shared_mutex> lock(listMutex);
+        orderList.displayDeliveries(buffer);
+    }
+    out << buffer.str();
+}
+
+/*********************************************************************
+void ConcurrentAirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Appends a batch of deliveries under one exclusive lock.
+Parameters:
+    I const vector<DeliveryRecord>& records - Deliveries to append
+Return Value:
+    None
+Notes:
+    Readers see either none or all of the batch.
+*********************************************************************/
+void ConcurrentAirshipOrderList::addDeliveries(const vector<DeliveryRecord>& records)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    orderList.addDeliveries(records);
+}
+
+/*********************************************************************
+vector<bool> ConcurrentAirshipOrderList::removeDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Removes a batch of deliveries under one exclusive lock.
+Parameters:
+    I const vector<DeliveryRecord>& records - Name/item of each delivery to remove
+Return Value:
+    vector<bool> - One entry per record, true if that record removed a node
+Notes:
+    None
+*********************************************************************/
+vector<bool> ConcurrentAirshipOrderList::removeDeliveries(const vector<DeliveryRecord>& records)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    return orderList.removeDeliveries(records);
+}
+
+/*********************************************************************
+vector<bool> ConcurrentAirshipOrderList::modifyDeliveries(const vector<DeliveryRecord>& records)
+Purpose:
+    Modifies a batch of deliveries under one exclusive lock.
+Parameters:
+    I const vector<DeliveryRecord>& records - Name/item plus new quantity and cost
+Return Value:
+    vector<bool> - One entry per record, true if its delivery was found
+Notes:
+    None
+*********************************************************************/
+vector<bool> ConcurrentAirshipOrderList::modifyDeliveries(const vector<DeliveryRecord>& records)
+{
+    std::unique_lock<std::shared_mutex> lock(listMutex);
+    return orderList.modifyDeliveries(records);
+}
+
+/*********************************************************************
+size_t ConcurrentAirshipOrderList::size() const
+Purpose:
+    Number of deliveries currently in the list.
+Parameters:
+    None
+Return Value:
+    size_t - Delivery count
+Notes:
+    None
+*********************************************************************/
+size_t ConcurrentAirshipOrderList::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(listMutex);
+    return orderList.size();
+}
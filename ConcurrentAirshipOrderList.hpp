@@ -0,0 +1,55 @@
+/*********************************************************************
+File name: ConcurrentAirshipOrderList.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the ConcurrentAirshipOrderList class, a thread
+    safe wrapper around AirshipOrderList.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for ConcurrentAirshipOrderList.
+Notes:
+    Readers share the lock, writers take it exclusively.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include <shared_mutex>
+#include <string>
+
+/*********************************************************************
+Class Name: ConcurrentAirshipOrderList
+Purpose:
+    AirshipOrderList that may be used from many threads at once.
+Notes:
+    Any number of readers run in parallel; a writer waits only for
+    readers already inside the list. Nothing hands out Delivery
+    pointers, since a node may be removed the moment the lock is
+    released: lookups copy the delivery out instead. Display formats
+    under the shared lock and writes to the stream after releasing
+    it, so slow terminal output never holds up writers.
+*********************************************************************/
+class ConcurrentAirshipOrderList
+{
+    private:
+        mutable std::shared_mutex listMutex;   // Guards orderList
+        AirshipOrderList orderList;            // Underlying manifest
+
+    public:
+        ConcurrentAirshipOrderList() = default;
+
+        void addDelivery(const string& szCust, const string& szItm, int iQty, Credits cost);
+        bool removeDelivery(const string& szCust, const string& szItm);
+        bool findDelivery(const string& szCust, const string& szItm, DeliveryRecord& found) const;
+        bool modifyDelivery(const string& szCust, const string& szItm, int iNewQty, Credits newCost);
+        void displayDeliveries(ostream& out) const;
+
+        void addDeliveries(const vector<DeliveryRecord>& records);
+        vector<bool> removeDeliveries(const vector<DeliveryRecord>& records);
+        vector<bool> modifyDeliveries(const vector<DeliveryRecord>& records);
+        size_t size() const;
+};
@@ -0,0 +1,184 @@
+/*********************************************************************
+File name: Credits.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the Credits class.
+Command Parameters:
+    N/A
+Input:
+    Amounts typed by players or read from generated scenarios.
+Results:
+    Exact cent amounts and their text.
+Notes:
+    None
+*********************************************************************/
+
+#include "Credits.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    const int64_t MAX_CENTS = std::numeric_limits<int64_t>::max();
+
+    /*********************************************************************
+    const char* digitPairs()
+    Purpose:
+        "00" through "99", so format() writes two digits per division.
+    *********************************************************************/
+    const char* digitPairs()
+    {
+        static const char pairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+        return pairs;
+    }
+}
+
+/*********************************************************************
+Credits Credits::fromDouble(double dCredits)
+Purpose:
+    Converts a floating point amount to the nearest cent.
+Parameters:
+    I double dCredits - Amount in credits
+Return Value:
+    Credits - Rounded amount
+Notes:
+    Halves round away from zero. NaN becomes zero and amounts out of
+    range are clamped.
+*********************************************************************/
+Credits Credits::fromDouble(double dCredits)
+{
+    if(std::isnan(dCredits)) return Credits();
+    double dCents = std::round(dCredits * CENTS_PER_CREDIT);
+    if(dCents >= static_cast<double>(MAX_CENTS)) return Credits(MAX_CENTS);
+    if(dCents <= -static_cast<double>(MAX_CENTS)) return Credits(-MAX_CENTS);
+    return Credits(static_cast<int64_t>(dCents));
+}
+
+/*********************************************************************
+const char* Credits::parse(const char* pBegin, const char* pEnd, Credits& value)
+Purpose:
+    Reads a decimal amount from the start of a range.
+Parameters:
+    I const char* pBegin - First character
+    I const char* pEnd - One past the last
+    O Credits& value - Amount read, untouched on failure
+Return Value:
+    const char* - One past the last character used, or pBegin if the
+                  range does not start with an amount
+Notes:
+    Accepts an optional '-', digits and an optional '.' with more
+    digits, like "12", "12.5", ".75" or "3.". Digits past the cents
+    round the amount half away from zero. Exponents and other text
+    after the amount are left for the caller. Fails on amounts that
+    do not fit.
+*********************************************************************/
+const char* Credits::parse(const char* pBegin, const char* pEnd, Credits& value)
+{
+    const char* pCursor = pBegin;
+    bool bNegative = (pCursor != pEnd && *pCursor == '-');
+    if(bNegative) pCursor++;
+
+    int64_t iWhole = 0;
+    size_t iDigits = 0;
+    for(; pCursor != pEnd && *pCursor >= '0' && *pCursor <= '9'; pCursor++, iDigits++)
+    {
+        if(iWhole > (MAX_CENTS / CENTS_PER_CREDIT - 10) / 10) return pBegin;
+        iWhole = iWhole * 10 + (*pCursor - '0');
+    }
+
+    int64_t iFraction = 0;
+    if(pCursor != pEnd && *pCursor == '.')
+    {
+        pCursor++;
+        int64_t iScale = CENTS_PER_CREDIT / 10;
+        for(; pCursor != pEnd && *pCursor >= '0' && *pCursor <= '9'; pCursor++, iDigits++)
+        {
+            if(iScale > 0)
+            {
+                iFraction += (*pCursor - '0') * iScale;
+                iScale /= 10;
+            }
+            else if(iScale == 0)
+            {
+                if(*pCursor >= '5') iFraction++;
+                iScale = -1;
+            }
+        }
+    }
+    if(iDigits == 0) return pBegin;
+
+    int64_t iAmount = iWhole * CENTS_PER_CREDIT + iFraction;
+    value = Credits(bNegative ? -iAmount : iAmount);
+    return pCursor;
+}
+
+/*********************************************************************
+char* Credits::format(char* pOut) const
+Purpose:
+    Writes the amount with exactly two decimals.
+Parameters:
+    O char* pOut - Buffer of at least MAX_FORMATTED characters
+Return Value:
+    char* - One past the last character written
+Notes:
+    Digits are built from the right two at a time, then copied to the
+    front of pOut. No terminator is written.
+*********************************************************************/
+char* Credits::format(char* pOut) const
+{
+    char buffer[MAX_FORMATTED];
+    char* pCursor = buffer + MAX_FORMATTED;
+    uint64_t iMagnitude = (iCents < 0) ? 0 - static_cast<uint64_t>(iCents) : static_cast<uint64_t>(iCents);
+    const char* pPairs = digitPairs();
+
+    uint64_t iCentsPart = iMagnitude % CENTS_PER_CREDIT;
+    uint64_t iWhole = iMagnitude / CENTS_PER_CREDIT;
+    pCursor -= 2;
+    std::memcpy(pCursor, pPairs + iCentsPart * 2, 2);
+    *--pCursor = '.';
+    while(iWhole >= 100)
+    {
+        pCursor -= 2;
+        std::memcpy(pCursor, pPairs + (iWhole % 100) * 2, 2);
+        iWhole /= 100;
+    }
+    if(iWhole >= 10)
+    {
+        pCursor -= 2;
+        std::memcpy(pCursor, pPairs + iWhole * 2, 2);
+    }
+    else
+    {
+        *--pCursor = static_cast<char>('0' + iWhole);
+    }
+    if(iCents < 0) *--pCursor = '-';
+
+    size_t iLength = static_cast<size_t>(buffer + MAX_FORMATTED - pCursor);
+    std::memcpy(pOut, pCursor, iLength);
+    return pOut + iLength;
+}
+
+/*********************************************************************
+std::ostream& operator<<(std::ostream& out, Credits amount)
+Purpose:
+    Writes an amount to a stream, two decimals regardless of the
+    stream's float settings.
+Parameters:
+    I/O std::ostream& out - Stream to write to
+    I Credits amount - Amount to write
+Return Value:
+    std::ostream& - out
+Notes:
+    Honors the stream's width and fill like a string would.
+*********************************************************************/
+std::ostream& operator<<(std::ostream& out, Credits amount)
+{
+    char text[Credits::MAX_FORMATTED];
+    return out << std::string_view(text, static_cast<size_t>(amount.format(text) - text));
+}
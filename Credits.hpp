@@ -0,0 +1,65 @@
+/*********************************************************************
+File name: Credits.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the Credits class, the currency type for delivery
+    costs.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for Credits.
+Notes:
+    Costs are declared to the cent, so they are kept as whole cents.
+*********************************************************************/
+
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+/*********************************************************************
+Class Name: Credits
+Purpose:
+    Fixed-point amount of credits held as a count of cents.
+Notes:
+    Sums are exact, where adding millions of doubles drifts by
+    fractions of a cent, and format() writes the amount with integer
+    arithmetic only, the way std::fixed with two decimals prints it.
+    Arithmetic does not check for overflow; an int64_t of cents holds
+    over 90 quadrillion credits.
+*********************************************************************/
+class Credits
+{
+    private:
+        int64_t iCents;                                 // Amount in hundredths of a credit
+
+        explicit constexpr Credits(int64_t iValue) : iCents(iValue) {}
+
+    public:
+        static const int64_t CENTS_PER_CREDIT = 100;    // Hundredths kept
+        static const size_t MAX_FORMATTED = 24;         // Longest format() output
+
+        constexpr Credits() : iCents(0) {}
+        static constexpr Credits fromCents(int64_t iValue) { return Credits(iValue); }
+        static Credits fromDouble(double dCredits);
+        static const char* parse(const char* pBegin, const char* pEnd, Credits& value);
+
+        constexpr int64_t cents() const { return iCents; }
+        double toDouble() const { return static_cast<double>(iCents) / CENTS_PER_CREDIT; }
+        char* format(char* pOut) const;
+
+        Credits& operator+=(Credits other) { iCents += other.iCents; return *this; }
+        Credits& operator-=(Credits other) { iCents -= other.iCents; return *this; }
+        friend constexpr Credits operator+(Credits left, Credits right) { return Credits(left.iCents + right.iCents); }
+        friend constexpr Credits operator-(Credits left, Credits right) { return Credits(left.iCents - right.iCents); }
+        friend constexpr bool operator==(Credits left, Credits right) = default;
+        friend constexpr auto operator<=>(Credits left, Credits right) = default;
+};
+
+std::ostream& operator<<(std::ostream& out, Credits amount);
@@ -0,0 +1,42 @@
+/*********************************************************************
+File name: CustomerProfile.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the CustomerProfile struct, the structured fields
+    a customer scene is rendered from.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Struct definition for CustomerProfile.
+Notes:
+    Used by SceneFormatter in place of a hand-written scene per
+    customer.
+*********************************************************************/
+
+#pragma once
+#include <string_view>
+
+/*********************************************************************
+Struct Name: CustomerProfile
+Purpose:
+    Everything a customer scene says about one customer and their
+    order.
+Notes:
+    Text fields are views; whoever fills the profile keeps the text
+    alive while it is rendered.
+*********************************************************************/
+struct CustomerProfile
+{
+    std::string_view szName;        // Name of the customer
+    std::string_view szArrival;     // Arrival time, e.g. "January 17 – 00:12"
+    std::string_view szItem;        // Item being shipped
+    int iQuantity = 0;              // How many items are shipped
+    double dCost = 0.0;             // Declared total cost
+    std::string_view szAccusation;  // What they say about another customer
+    std::string_view szRiddle;      // Their riddle, empty for none
+    std::string_view szSprite;      // ASCII art shown above the scene
+};
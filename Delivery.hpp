@@ -0,0 +1,58 @@
+/*********************************************************************
+File name: Delivery.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the Delivery node and the plain delivery record
+    types shared by the manifest containers.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Struct definitions for Delivery and DeliveryRecord.
+Notes:
+    Delivery is the linked list node owned by AirshipOrderList. Its
+    text is InlineString so short names and items need no heap block.
+    Costs are Credits, whole cents, so totals over a manifest are
+    exact.
+*********************************************************************/
+
+#pragma once
+#include "Credits.hpp"
+#include "InlineString.hpp"
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+using namespace std;
+
+struct Delivery 
+{
+    InlineString szName;    // Name of the customer
+    InlineString szItem;    // Item purchased
+    int iQuantity;          // How many items were purchased
+    uint32_t iSequence = 0; // Place in the list when appended or last sorted
+    Credits cost;           // Total cost of delivery
+    Delivery* pNext = nullptr; // Next delivery
+
+    Delivery(string_view szN, string_view szI, int iQ, Credits c) :
+        szName(szN), szItem(szI), iQuantity(iQ), cost(c){}
+};
+
+/*********************************************************************
+Struct Name: DeliveryRecord
+Purpose:
+    Plain value copy of a delivery used by the batch operations.
+Notes:
+    Remove operations only look at szName and szItem.
+*********************************************************************/
+struct DeliveryRecord
+{
+    string szName;          // Name of the customer
+    string szItem;          // Item purchased
+    int iQuantity = 0;      // How many items were purchased
+    Credits cost;           // Total cost of delivery
+};
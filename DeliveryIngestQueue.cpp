@@ -0,0 +1,196 @@
+/*********************************************************************
+File name: DeliveryIngestQueue.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the DeliveryIngestQueue class.
+Command Parameters:
+    N/A
+Input:
+    Delivery records from any number of producer threads.
+Results:
+    Batches of deliveries appended to an order list.
+Notes:
+    Only drain() and drainInto() touch pTail, and they must only be
+    called from the single consumer thread.
+*********************************************************************/
+
+#include "DeliveryIngestQueue.hpp"
+#include <utility>
+
+/*********************************************************************
+DeliveryIngestQueue::DeliveryIngestQueue()
+Purpose:
+    Constructor that creates an empty queue.
+Parameters:
+    None
+Return Value:
+    None (constructor)
+Notes:
+    Head and tail both start on the stub node.
+*********************************************************************/
+DeliveryIngestQueue::DeliveryIngestQueue() : pHead(&stub), pTail(&stub) {}
+
+/*********************************************************************
+DeliveryIngestQueue::~DeliveryIngestQueue()
+Purpose:
+    Destructor that frees any records never drained.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    Producers must have stopped before the queue is destroyed.
+*********************************************************************/
+DeliveryIngestQueue::~DeliveryIngestQueue()
+{
+    IngestNode* node;
+    while((node = popNode()) != nullptr)
+    {
+        delete node;
+    }
+}
+
+/*********************************************************************
+void DeliveryIngestQueue::pushNode(IngestNode* node)
+Purpose:
+    Links a node in at the producer end.
+Parameters:
+    I/O IngestNode* node - Node to append
+Return Value:
+    None
+Notes:
+    Wait-free: one exchange and one release store.
+*********************************************************************/
+void DeliveryIngestQueue::pushNode(IngestNode* node)
+{
+    node->pNext.store(nullptr, std::memory_order_relaxed);
+    IngestNode* prev = pHead.exchange(node, std::memory_order_acq_rel);
+    prev->pNext.store(node, std::memory_order_release);
+}
+
+/*********************************************************************
+DeliveryIngestQueue::IngestNode* DeliveryIngestQueue::popNode()
+Purpose:
+    Unlinks the oldest fully published node.
+Parameters:
+    None
+Return Value:
+    IngestNode* - Oldest node, or nullptr if none is ready
+Notes:
+    Consumer only. The caller owns and deletes the returned node.
+*********************************************************************/
+DeliveryIngestQueue::IngestNode* DeliveryIngestQueue::popNode()
+{
+    IngestNode* tail = pTail;
+    IngestNode* next = tail->pNext.load(std::memory_order_acquire);
+
+    if(tail == &stub)
+    {
+        if(next == nullptr) return nullptr;
+        pTail = next;
+        tail = next;
+        next = next->pNext.load(std::memory_order_acquire);
+    }
+
+    if(next != nullptr)
+    {
+        pTail = next;
+        return tail;
+    }
+
+    // tail is the last node; a producer may still be linking after it
+    if(tail != pHead.load(std::memory_order_acquire)) return nullptr;
+
+    pushNode(&stub);
+    next = tail->pNext.load(std::memory_order_acquire);
+    if(next != nullptr)
+    {
+        pTail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+/*********************************************************************
+void DeliveryIngestQueue::enqueue(DeliveryRecord record)
+Purpose:
+    Submits a delivery from any producer thread.
+Parameters:
+    I DeliveryRecord record - Delivery to queue
+Return Value:
+    None
+Notes:
+    Never blocks on other producers or on the consumer.
+*********************************************************************/
+void DeliveryIngestQueue::enqueue(DeliveryRecord record)
+{
+    IngestNode* node = new IngestNode;
+    node->record = std::move(record);
+    pushNode(node);
+}
+
+/*********************************************************************
+size_t DeliveryIngestQueue::drain(vector<DeliveryRecord>& batch, size_t iMaxBatch)
+Purpose:
+    Moves up to iMaxBatch queued records into batch.
+Parameters:
+    O vector<DeliveryRecord>& batch - Cleared, then filled in arrival order
+    I size_t iMaxBatch - Largest number of records to take
+Return Value:
+    size_t - Number of records drained
+Notes:
+    Consumer only.
+*********************************************************************/
+size_t DeliveryIngestQueue::drain(vector<DeliveryRecord>& batch, size_t iMaxBatch)
+{
+    batch.clear();
+    IngestNode* node;
+    while(batch.size() < iMaxBatch && (node = popNode()) != nullptr)
+    {
+        batch.push_back(std::move(node->record));
+        delete node;
+    }
+    return batch.size();
+}
+
+/*********************************************************************
+size_t DeliveryIngestQueue::drainInto(AirshipOrderList& orderList, size_t iMaxBatch)
+Purpose:
+    Drains one batch straight into an order list.
+Parameters:
+    I/O AirshipOrderList& orderList - List to append to
+    I size_t iMaxBatch - Largest number of records to take
+Return Value:
+    size_t - Number of deliveries added
+Notes:
+    Consumer only.
+*********************************************************************/
+size_t DeliveryIngestQueue::drainInto(AirshipOrderList& orderList, size_t iMaxBatch)
+{
+    vector<DeliveryRecord> batch;
+    batch.reserve(iMaxBatch);
+    if(drain(batch, iMaxBatch) > 0) orderList.addDeliveries(batch);
+    return batch.size();
+}
+
+/*********************************************************************
+size_t DeliveryIngestQueue::drainInto(ConcurrentAirshipOrderList& orderList, size_t iMaxBatch)
+Purpose:
+    Drains one batch into a shared order list under a single lock.
+Parameters:
+    I/O ConcurrentAirshipOrderList& orderList - List to append to
+    I size_t iMaxBatch - Largest number of records to take
+Return Value:
+    size_t - Number of deliveries added
+Notes:
+    Consumer only.
+*********************************************************************/
+size_t DeliveryIngestQueue::drainInto(ConcurrentAirshipOrderList& orderList, size_t iMaxBatch)
+{
+    vector<DeliveryRecord> batch;
+    batch.reserve(iMaxBatch);
+    if(drain(batch, iMaxBatch) > 0) orderList.addDeliveries(batch);
+    return batch.size();
+}
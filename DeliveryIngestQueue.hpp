@@ -0,0 +1,64 @@
+/*********************************************************************
+File name: DeliveryIngestQueue.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the DeliveryIngestQueue class, a lock-free queue
+    that lets many dock terminals submit deliveries at once.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for DeliveryIngestQueue.
+Notes:
+    Many producers, exactly one consumer.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include "ConcurrentAirshipOrderList.hpp"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/*********************************************************************
+Class Name: DeliveryIngestQueue
+Purpose:
+    Multi-producer single-consumer queue of DeliveryRecords feeding
+    an order list in batches.
+Notes:
+    Intrusive Vyukov queue: enqueue is one atomic exchange plus one
+    store and never waits on other producers or the consumer. The
+    consumer drains up to a batch worth of records at a time and
+    hands them to addDeliveries. A record whose producer is between
+    its two steps is picked up by the next drain.
+*********************************************************************/
+class DeliveryIngestQueue
+{
+    private:
+        struct IngestNode
+        {
+            std::atomic<IngestNode*> pNext{nullptr};   // Next node towards the producers
+            DeliveryRecord record;                     // Queued delivery
+        };
+
+        std::atomic<IngestNode*> pHead;   // Most recently enqueued node (producers)
+        IngestNode* pTail;                // Oldest node (consumer only)
+        IngestNode stub;                  // Placeholder that keeps the queue non-empty
+
+        void pushNode(IngestNode* node);
+        IngestNode* popNode();
+
+    public:
+        DeliveryIngestQueue();
+        ~DeliveryIngestQueue();
+        DeliveryIngestQueue(const DeliveryIngestQueue&) = delete;
+        DeliveryIngestQueue& operator=(const DeliveryIngestQueue&) = delete;
+
+        void enqueue(DeliveryRecord record);
+        size_t drain(vector<DeliveryRecord>& batch, size_t iMaxBatch);
+        size_t drainInto(AirshipOrderList& orderList, size_t iMaxBatch);
+        size_t drainInto(ConcurrentAirshipOrderList& orderList, size_t iMaxBatch);
+};
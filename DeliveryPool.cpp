@@ -0,0 +1,371 @@
+/*********************************************************************
+File name: DeliveryPool.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the DeliveryPool class. Allocates Delivery
+    node storage in chunks and recycles freed nodes.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Provides node storage for AirshipOrderList.
+Notes:
+    Chunks grow geometrically so repeated appends stay amortized O(1).
+*********************************************************************/
+
+#include "DeliveryPool.hpp"
+#include "ListInstrumentation.hpp"
+#include <algorithm>
+#include <functional>
+#include <new>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    const size_t MIN_CHUNK_SLOTS = 8;    // Smallest chunk added once the inline slots are used
+
+    /*********************************************************************
+    size_t nextMatch(const uint32_t* pFingerprints, size_t iCount, uint32_t iFingerprint, size_t i)
+    Purpose:
+        Index of the first fingerprint at or after i equal to
+        iFingerprint, or iCount. With SSE2, 16 fingerprints are compared
+        per step and only a block with a hit is rescanned one by one.
+    *********************************************************************/
+    size_t nextMatch(const uint32_t* pFingerprints, size_t iCount, uint32_t iFingerprint, size_t i)
+    {
+#ifdef __SSE2__
+        const __m128i needle = _mm_set1_epi32(static_cast<int>(iFingerprint));
+        for(; i + 16 <= iCount; i += 16)
+        {
+            const __m128i* pBlock = reinterpret_cast<const __m128i*>(pFingerprints + i);
+            __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(pBlock), needle),
+                                                     _mm_cmpeq_epi32(_mm_loadu_si128(pBlock + 1), needle)),
+                                        _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(pBlock + 2), needle),
+                                                     _mm_cmpeq_epi32(_mm_loadu_si128(pBlock + 3), needle)));
+            if(_mm_movemask_epi8(hits) != 0) break;
+        }
+#endif
+        for(; i < iCount; i++)
+        {
+            if(pFingerprints[i] == iFingerprint) return i;
+        }
+        return iCount;
+    }
+}
+
+static_assert(offsetof(Delivery, szName) + InlineString::TAG_OFFSET >= sizeof(void*),
+              "a free slot's tag byte must not overlap its free list link");
+
+/*********************************************************************
+void DeliveryPool::pushFree(Slot* slot)
+Purpose:
+    Puts a slot on the free list and tags it as free.
+Parameters:
+    I/O Slot* slot - Slot holding no node
+Return Value:
+    None
+Notes:
+    Also clears its fingerprint so find() never stops on it.
+*********************************************************************/
+void DeliveryPool::pushFree(Slot* slot)
+{
+    slot->pNextFree = pFreeList;
+    slot->storage[offsetof(Delivery, szName) + InlineString::TAG_OFFSET] = InlineString::UNUSED_TAG;
+    fingerprintOf(slot) = FREE_FINGERPRINT;
+    pFreeList = slot;
+    iFreeCount++;
+}
+
+/*********************************************************************
+void DeliveryPool::addChunk(size_t iSlots)
+Purpose:
+    Allocates a new chunk and makes it the bump region.
+Parameters:
+    I size_t iSlots - Number of slots in the new chunk
+Return Value:
+    None
+Notes:
+    Untouched slots left in the previous bump region are pushed onto
+    the free list so they are not lost.
+*********************************************************************/
+void DeliveryPool::addChunk(size_t iSlots)
+{
+    while(pBumpNext != pBumpEnd)
+    {
+        pushFree(pBumpNext++);
+    }
+
+    registerChunk(std::unique_ptr<Slot[]>(new Slot[iSlots]), std::unique_ptr<uint32_t[]>(new uint32_t[iSlots]()), iSlots);
+    pBumpNext = chunks.back().pSlots.get();
+    pBumpEnd = pBumpNext + iSlots;
+}
+
+/*********************************************************************
+void DeliveryPool::registerChunk(std::unique_ptr<Slot[]> pSlots, std::unique_ptr<uint32_t[]> pFingerprints, size_t iSlots)
+Purpose:
+    Takes ownership of a new chunk and indexes it by address.
+Parameters:
+    I std::unique_ptr<Slot[]> pSlots - The chunk's slots
+    I std::unique_ptr<uint32_t[]> pFingerprints - One fingerprint per slot
+    I size_t iSlots - Slots in the chunk
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void DeliveryPool::registerChunk(std::unique_ptr<Slot[]> pSlots, std::unique_ptr<uint32_t[]> pFingerprints, size_t iSlots)
+{
+    chunks.push_back(Chunk{ std::move(pSlots), std::move(pFingerprints), iSlots });
+    INSTRUMENT_BYTES(iSlots * (sizeof(Slot) + sizeof(uint32_t)));
+    iCapacity += iSlots;
+
+    const Slot* pBegin = chunks.back().pSlots.get();
+    auto position = std::upper_bound(chunksByAddress.begin(), chunksByAddress.end(), pBegin,
+                                     [this](const Slot* pSlot, size_t iChunk) { return std::less<const Slot*>()(pSlot, chunks[iChunk].pSlots.get()); });
+    chunksByAddress.insert(position, chunks.size() - 1);
+}
+
+/*********************************************************************
+uint32_t& DeliveryPool::fingerprintOf(const Slot* slot)
+Purpose:
+    Finds the fingerprint entry belonging to a slot.
+Parameters:
+    I const Slot* slot - Any slot of this pool
+Return Value:
+    uint32_t& - Its fingerprint
+Notes:
+    Binary search over the chunks by address; there are only a few
+    dozen even for 10M nodes because chunks grow geometrically.
+*********************************************************************/
+uint32_t& DeliveryPool::fingerprintOf(const Slot* slot)
+{
+    std::less<const Slot*> before;
+    if(!before(slot, inlineSlots) && before(slot, inlineSlots + INLINE_SLOTS)) return inlineFingerprints[slot - inlineSlots];
+
+    auto position = std::upper_bound(chunksByAddress.begin(), chunksByAddress.end(), slot,
+                                     [&](const Slot* pSlot, size_t iChunk) { return before(pSlot, chunks[iChunk].pSlots.get()); });
+    Chunk& chunk = chunks[*(position - 1)];
+    return chunk.pFingerprints[slot - chunk.pSlots.get()];
+}
+
+/*********************************************************************
+void DeliveryPool::reserve(size_t iCount)
+Purpose:
+    Guarantees that iCount nodes can be created without another
+    allocation.
+Parameters:
+    I size_t iCount - Number of nodes about to be created
+Return Value:
+    None
+Notes:
+    Does nothing if enough free slots already exist.
+*********************************************************************/
+void DeliveryPool::reserve(size_t iCount)
+{
+    size_t iAvailable = available();
+    if(iAvailable >= iCount) return;
+
+    addChunk(std::max(iCount - iAvailable, MIN_CHUNK_SLOTS));
+}
+
+/*********************************************************************
+Delivery* DeliveryPool::create(string_view szName, string_view szItem, int iQuantity, Credits cost)
+Purpose:
+    Constructs a new Delivery node in pool storage.
+Parameters:
+    I string_view szName - Customer name
+    I string_view szItem - Item description
+    I int iQuantity - Quantity of items
+    I Credits cost - Cost of delivery
+Return Value:
+    Delivery* - The newly constructed node
+Notes:
+    Reuses a freed slot first, then the bump region (the inline slots
+    until they run out), then grows. A reused slot, or a bump region
+    that a block from allocateBlock() was stored after, puts the new
+    node ahead of older ones in storage order.
+*********************************************************************/
+Delivery* DeliveryPool::create(string_view szName, string_view szItem, int iQuantity, Credits cost)
+{
+    Slot* slot;
+    if(pFreeList != nullptr)
+    {
+        slot = pFreeList;
+        pFreeList = pFreeList->pNextFree;
+        iFreeCount--;
+        bInListOrder = false;
+    }
+    else
+    {
+        if(pBumpNext == pBumpEnd)
+        {
+            addChunk(std::max(iCapacity, MIN_CHUNK_SLOTS));
+        }
+        const Slot* pLastEnd = chunks.empty() ? inlineSlots + INLINE_SLOTS : chunks.back().pSlots.get() + chunks.back().iSlots;
+        if(pBumpEnd != pLastEnd) bInListOrder = false;
+        slot = pBumpNext++;
+    }
+
+    fingerprintOf(slot) = fingerprint(szName, szItem);
+    return new (slot->storage) Delivery(szName, szItem, iQuantity, cost);
+}
+
+/*********************************************************************
+void DeliveryPool::destroy(Delivery* delivery)
+Purpose:
+    Destroys a node and returns its slot to the free list.
+Parameters:
+    I/O Delivery* delivery - Node previously returned by create()
+Return Value:
+    None
+Notes:
+    Passing nullptr is a no-op.
+*********************************************************************/
+void DeliveryPool::destroy(Delivery* delivery)
+{
+    if(delivery == nullptr) return;
+
+    delivery->~Delivery();
+    pushFree(reinterpret_cast<Slot*>(delivery));
+}
+
+/*********************************************************************
+Delivery* DeliveryPool::allocateBlock(size_t iCount)
+Purpose:
+    Hands out iCount adjacent slots in a chunk of their own.
+Parameters:
+    I size_t iCount - Nodes about to be built
+Return Value:
+    Delivery* - Storage for node 0; node i goes at pointer + i
+Notes:
+    The caller must construct() every slot before the pool is used
+    again, and may do so from several threads. The bump region is left
+    alone, so a block never wastes the slots already reserved.
+    Returns nullptr for an empty block.
+*********************************************************************/
+Delivery* DeliveryPool::allocateBlock(size_t iCount)
+{
+    if(iCount == 0) return nullptr;
+
+    registerChunk(std::unique_ptr<Slot[]>(new Slot[iCount]), std::unique_ptr<uint32_t[]>(new uint32_t[iCount]), iCount);
+    return reinterpret_cast<Delivery*>(chunks.back().pSlots.get());
+}
+
+/*********************************************************************
+vector<DeliveryPool::SlotSpan> DeliveryPool::spans(size_t iMaxSlots) const
+Purpose:
+    Splits every slot ever handed out into runs for a parallel scan.
+Parameters:
+    I size_t iMaxSlots - Longest run returned
+Return Value:
+    vector<SlotSpan> - Runs in storage order, not list order
+Notes:
+    Untouched slots at the end of the bump region are left out; freed
+    slots are not, so callers check isLive().
+*********************************************************************/
+vector<DeliveryPool::SlotSpan> DeliveryPool::spans(size_t iMaxSlots) const
+{
+    vector<SlotSpan> result;
+    forEachUsedRun([&](const Slot* pBegin, const uint32_t*, size_t iSlots)
+    {
+        for(size_t iDone = 0; iDone < iSlots; iDone += iMaxSlots)
+        {
+            result.push_back(SlotSpan{ reinterpret_cast<const Delivery*>(pBegin + iDone), std::min(iMaxSlots, iSlots - iDone) });
+        }
+    });
+    return result;
+}
+
+/*********************************************************************
+Delivery* DeliveryPool::construct(Delivery* pSlot, string_view szName, string_view szItem, int iQuantity, Credits cost)
+Purpose:
+    Builds a node in a slot from allocateBlock().
+Parameters:
+    I/O Delivery* pSlot - Slot to build in
+    I string_view szName - Customer name
+    I string_view szItem - Item description
+    I int iQuantity - Quantity of items
+    I Credits cost - Cost of delivery
+Return Value:
+    Delivery* - The node
+Notes:
+    Safe to call from several threads for different slots.
+*********************************************************************/
+Delivery* DeliveryPool::construct(Delivery* pSlot, string_view szName, string_view szItem, int iQuantity, Credits cost)
+{
+    fingerprintOf(reinterpret_cast<const Slot*>(pSlot)) = fingerprint(szName, szItem);
+    return new (static_cast<void*>(pSlot)) Delivery(szName, szItem, iQuantity, cost);
+}
+
+/*********************************************************************
+Delivery* DeliveryPool::find(string_view szName, string_view szItem, size_t* pScanned) const
+Purpose:
+    Finds the earliest listed node with a given name and item.
+Parameters:
+    I string_view szName - Customer name
+    I string_view szItem - Item description
+    O size_t* pScanned - Fingerprints scanned, if not nullptr
+Return Value:
+    Delivery* - Matching node with the lowest iSequence, or nullptr
+Notes:
+    Scans the fingerprint arrays rather than the nodes, so a miss
+    reads 4 bytes per node and never follows a pointer. Only slots
+    whose fingerprint matches are compared in full. While slots are
+    in list order, the first match is the earliest listed and the
+    scan stops there, so a hit near the head costs about what a list
+    walk does. Once they are not, every used slot is scanned to find
+    the lowest iSequence, hit or miss (see benchLookupHits).
+*********************************************************************/
+Delivery* DeliveryPool::find(string_view szName, string_view szItem, size_t* pScanned) const
+{
+    uint32_t iFingerprint = fingerprint(szName, szItem);
+    Delivery* pFound = nullptr;
+    size_t iScanned = 0;
+    forEachUsedRun([&](const Slot* pSlots, const uint32_t* pFingerprints, size_t iSlots)
+    {
+        if(pFound != nullptr && bInListOrder) return;
+        for(size_t i = nextMatch(pFingerprints, iSlots, iFingerprint, 0); i < iSlots; i = nextMatch(pFingerprints, iSlots, iFingerprint, i + 1))
+        {
+            Delivery* pNode = reinterpret_cast<Delivery*>(const_cast<Slot*>(pSlots + i));
+            if(pNode->szName == szName && pNode->szItem == szItem && (pFound == nullptr || pNode->iSequence < pFound->iSequence))
+            {
+                pFound = pNode;
+                if(bInListOrder)
+                {
+                    iScanned += i + 1;
+                    return;
+                }
+            }
+        }
+        iScanned += iSlots;
+    });
+    if(pScanned != nullptr) *pScanned = iScanned;
+    return pFound;
+}
+
+/*********************************************************************
+uint32_t DeliveryPool::fingerprint(string_view szName, string_view szItem)
+Purpose:
+    Short summary of a name and item for filtering lookups.
+Parameters:
+    I string_view szName - Customer name
+    I string_view szItem - Item description
+Return Value:
+    uint32_t - 24 bits of hash over 8 bits of combined length, never
+               FREE_FINGERPRINT
+Notes:
+    Equal text always gives equal fingerprints; unequal text collides
+    about once in 16M lookups of the same length.
+*********************************************************************/
+uint32_t DeliveryPool::fingerprint(string_view szName, string_view szItem)
+{
+    uint64_t iHash = std::hash<string_view>()(szName) * 0x9e3779b97f4a7c15ULL ^ std::hash<string_view>()(szItem);
+    uint32_t iFingerprint = (static_cast<uint32_t>(iHash >> 32) & 0xFFFFFF00u)
+                          | static_cast<uint32_t>(std::min<size_t>(szName.size() + szItem.size(), 0xFF));
+    return (iFingerprint == FREE_FINGERPRINT) ? 1 : iFingerprint;
+}
@@ -0,0 +1,148 @@
+/*********************************************************************
+File name: DeliveryPool.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the DeliveryPool class which hands out storage
+    for Delivery nodes in large chunks.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for DeliveryPool.
+Notes:
+    Used by AirshipOrderList so bulk loads do not pay for one heap
+    allocation per node.
+*********************************************************************/
+
+#pragma once
+#include "Delivery.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+/*********************************************************************
+Class Name: DeliveryPool
+Purpose:
+    Chunked slab allocator for Delivery nodes.
+Notes:
+    The first INLINE_SLOTS nodes live inside the pool object itself,
+    so a shift-sized manifest needs no chunk at all; heap chunks are
+    only added once those are used up. Freed slots are kept on an
+    intrusive free list and reused before any new chunk is allocated.
+    All chunks are released together when the pool is destroyed, so
+    every node must be destroyed first. Free slots carry
+    InlineString::UNUSED_TAG where a node keeps its name's tag byte,
+    so spans() can be walked in parallel without following the list.
+    Beside the slots, each chunk keeps a contiguous fingerprint per
+    slot (see fingerprint()) that find() scans with SIMD compares
+    before reading any node. Until a freed slot is reused, a slot
+    behind an older one is handed out, or markReordered() is called,
+    slots are in list order and find() stops at its first match.
+*********************************************************************/
+class DeliveryPool
+{
+    private:
+        union Slot
+        {
+            Slot* pNextFree;                                        // Next slot on the free list
+            alignas(Delivery) unsigned char storage[sizeof(Delivery)]; // Raw node storage
+        };
+        static_assert(sizeof(Slot) == sizeof(Delivery), "slots must be indexable as a Delivery array");
+
+        /*********************************************************************
+        Struct Name: Chunk
+        Purpose:
+            One heap allocation of slots.
+        *********************************************************************/
+        struct Chunk
+        {
+            std::unique_ptr<Slot[]> pSlots;                         // The slots
+            std::unique_ptr<uint32_t[]> pFingerprints;              // Fingerprint of each slot
+            size_t iSlots;                                          // How many
+        };
+
+    public:
+        static const size_t INLINE_SLOTS = 6;                      // Nodes stored in the pool object, one shift's worth
+        static const uint32_t FREE_FINGERPRINT = 0;                // Fingerprint of a slot holding no node
+
+        /*********************************************************************
+        Struct Name: SlotSpan
+        Purpose:
+            Run of consecutive slots that have been handed out at least
+            once; use isLive() to skip the ones freed since.
+        *********************************************************************/
+        struct SlotSpan
+        {
+            const Delivery* pFirst;                                 // First slot
+            size_t iSlots;                                          // Slots in the run
+        };
+
+    private:
+        Slot inlineSlots[INLINE_SLOTS];                            // Storage used before any chunk
+        uint32_t inlineFingerprints[INLINE_SLOTS] = {};            // Fingerprints of the inline slots
+        std::vector<Chunk> chunks;                                 // Every chunk owned by the pool
+        std::vector<size_t> chunksByAddress;                       // Indices into chunks, lowest address first
+        Slot* pFreeList = nullptr;                                 // Recycled slots
+        Slot* pBumpNext = inlineSlots;                             // Next untouched slot in newest chunk
+        Slot* pBumpEnd = inlineSlots + INLINE_SLOTS;               // End of newest chunk
+        size_t iCapacity = INLINE_SLOTS;                           // Total slots, inline and in chunks
+        size_t iFreeCount = 0;                                     // Slots on the free list
+        bool bInListOrder = true;                                  // Storage order is still list order
+
+        void addChunk(size_t iSlots);
+        void registerChunk(std::unique_ptr<Slot[]> pSlots, std::unique_ptr<uint32_t[]> pFingerprints, size_t iSlots);
+        void pushFree(Slot* slot);
+        uint32_t& fingerprintOf(const Slot* slot);
+
+        /*********************************************************************
+        void forEachUsedRun(Visit&& visit) const
+        Purpose:
+            Calls visit(const Slot*, const uint32_t*, size_t) with the
+            slots and fingerprints of the inline slots and each chunk,
+            up to the last slot ever handed out.
+        *********************************************************************/
+        template<typename Visit>
+        void forEachUsedRun(Visit&& visit) const
+        {
+            size_t iInlineUsed = (pBumpEnd == inlineSlots + INLINE_SLOTS) ? static_cast<size_t>(pBumpNext - inlineSlots) : INLINE_SLOTS;
+            visit(static_cast<const Slot*>(inlineSlots), static_cast<const uint32_t*>(inlineFingerprints), iInlineUsed);
+            for(const Chunk& chunk : chunks)
+            {
+                const Slot* pBegin = chunk.pSlots.get();
+                bool bBumping = (pBumpEnd == pBegin + chunk.iSlots);
+                visit(pBegin, static_cast<const uint32_t*>(chunk.pFingerprints.get()),
+                      bBumping ? static_cast<size_t>(pBumpNext - pBegin) : chunk.iSlots);
+            }
+        }
+
+    public:
+        DeliveryPool() = default;
+        DeliveryPool(const DeliveryPool&) = delete;
+        DeliveryPool& operator=(const DeliveryPool&) = delete;
+
+        void reserve(size_t iCount);
+        Delivery* create(string_view szName, string_view szItem, int iQuantity, Credits cost);
+        void destroy(Delivery* delivery);
+        Delivery* allocateBlock(size_t iCount);
+        std::vector<SlotSpan> spans(size_t iMaxSlots) const;
+        Delivery* construct(Delivery* pSlot, string_view szName, string_view szItem, int iQuantity, Credits cost);
+        Delivery* find(string_view szName, string_view szItem, size_t* pScanned = nullptr) const;
+        static uint32_t fingerprint(string_view szName, string_view szItem);
+        void markReordered() { bInListOrder = false; }
+        static bool isLive(const Delivery* pSlot)
+        {
+            return reinterpret_cast<const unsigned char*>(pSlot)[offsetof(Delivery, szName) + InlineString::TAG_OFFSET] != InlineString::UNUSED_TAG;
+        }
+        size_t capacity() const { return iCapacity; }
+        size_t available() const { return iFreeCount + static_cast<size_t>(pBumpEnd - pBumpNext); }
+        size_t footprintBytes() const
+        {
+            return (iCapacity - INLINE_SLOTS) * (sizeof(Slot) + sizeof(uint32_t)) + chunks.capacity() * sizeof(chunks[0])
+                 + chunksByAddress.capacity() * sizeof(chunksByAddress[0]);
+        }
+};
@@ -0,0 +1,317 @@
+/*********************************************************************
+File name: DeliverySearchIndex.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the DeliverySearchIndex class.
+Command Parameters:
+    N/A
+Input:
+    A manifest to index and search queries.
+Results:
+    Deliveries whose name or item starts close to the query.
+Notes:
+    Case is folded for ASCII letters only.
+*********************************************************************/
+
+#include "DeliverySearchIndex.hpp"
+#include <algorithm>
+
+namespace
+{
+    const size_t KEY_WORDS = 4;                 // Words of folded text packed into a sort key
+    const size_t KEY_CHARS = KEY_WORDS * 8;     // Characters the key holds
+
+    /*********************************************************************
+    struct TextEntry
+    Purpose:
+        One name or item of one delivery while the index is built.
+    *********************************************************************/
+    struct TextEntry
+    {
+        uint64_t keyWords[KEY_WORDS];   // First KEY_CHARS folded bytes, big-endian
+        const Delivery* pNode;          // Delivery the text belongs to
+        uint32_t iPosition;             // Its place in the list
+        uint8_t iLength;                // Indexed length, at most MAX_TEXT
+        bool bItem;                     // Item text rather than a name
+    };
+
+    /*********************************************************************
+    unsigned char foldChar(char c)
+    Purpose:
+        Lowercases an ASCII letter, leaving every other byte alone.
+    *********************************************************************/
+    unsigned char foldChar(char c)
+    {
+        unsigned char iByte = static_cast<unsigned char>(c);
+        return (iByte >= 'A' && iByte <= 'Z') ? static_cast<unsigned char>(iByte + ('a' - 'A')) : iByte;
+    }
+
+    /*********************************************************************
+    std::string_view textOf(const TextEntry& entry)
+    Purpose:
+        The indexed part of an entry's name or item.
+    *********************************************************************/
+    std::string_view textOf(const TextEntry& entry)
+    {
+        std::string_view szText = entry.bItem ? entry.pNode->szItem.view() : entry.pNode->szName.view();
+        return szText.substr(0, entry.iLength);
+    }
+
+    /*********************************************************************
+    void packFolded(std::string_view szText, uint64_t* pWords)
+    Purpose:
+        Packs the first KEY_CHARS folded bytes so integer order is text
+        order.
+    *********************************************************************/
+    void packFolded(std::string_view szText, uint64_t* pWords)
+    {
+        for(size_t iWord = 0; iWord < KEY_WORDS; iWord++)
+        {
+            uint64_t iWordValue = 0;
+            for(size_t i = iWord * 8; i < iWord * 8 + 8; i++)
+            {
+                iWordValue = (iWordValue << 8) | (i < szText.size() ? foldChar(szText[i]) : 0);
+            }
+            pWords[iWord] = iWordValue;
+        }
+    }
+
+    /*********************************************************************
+    int compareFolded(std::string_view szLeft, std::string_view szRight)
+    Purpose:
+        Three-way comparison of two texts with case folded.
+    *********************************************************************/
+    int compareFolded(std::string_view szLeft, std::string_view szRight)
+    {
+        size_t iShared = std::min(szLeft.size(), szRight.size());
+        for(size_t i = 0; i < iShared; i++)
+        {
+            unsigned char iLeft = foldChar(szLeft[i]);
+            unsigned char iRight = foldChar(szRight[i]);
+            if(iLeft != iRight) return iLeft < iRight ? -1 : 1;
+        }
+        if(szLeft.size() == szRight.size()) return 0;
+        return szLeft.size() < szRight.size() ? -1 : 1;
+    }
+
+    /*********************************************************************
+    int compareTexts(const TextEntry& left, const TextEntry& right)
+    Purpose:
+        Three-way comparison of two entries' folded texts, reading the
+        nodes only when both keys are full and equal.
+    *********************************************************************/
+    int compareTexts(const TextEntry& left, const TextEntry& right)
+    {
+        for(size_t iWord = 0; iWord < KEY_WORDS; iWord++)
+        {
+            if(left.keyWords[iWord] != right.keyWords[iWord]) return left.keyWords[iWord] < right.keyWords[iWord] ? -1 : 1;
+        }
+        if(left.iLength > KEY_CHARS || right.iLength > KEY_CHARS) return compareFolded(textOf(left), textOf(right));
+        if(left.iLength == right.iLength) return 0;
+        return left.iLength < right.iLength ? -1 : 1;
+    }
+}
+
+/*********************************************************************
+DeliverySearchIndex::DeliverySearchIndex(const AirshipOrderList& airshipOrderList)
+Purpose:
+    Constructor that indexes every name and item in a manifest.
+Parameters:
+    I const AirshipOrderList& airshipOrderList - Manifest to index
+Return Value:
+    None (constructor)
+Notes:
+    Texts are sorted by a packed key of their first KEY_CHARS folded
+    bytes, so only longer texts that tie on it are read from the
+    nodes again. Equal texts of one field are then merged into a term
+    that lists its deliveries in list order.
+*********************************************************************/
+DeliverySearchIndex::DeliverySearchIndex(const AirshipOrderList& airshipOrderList) :
+    iRevision(airshipOrderList.getRevision())
+{
+    std::vector<TextEntry> entries(airshipOrderList.size() * 2);
+    size_t iEntry = 0;
+    uint32_t iPosition = 0;
+    for(const Delivery* pNode = airshipOrderList.getHead(); pNode != nullptr; pNode = pNode->pNext)
+    {
+        for(bool bItem : { false, true })
+        {
+            TextEntry& entry = entries[iEntry++];
+            std::string_view szText = bItem ? pNode->szItem.view() : pNode->szName.view();
+            szText = szText.substr(0, MAX_TEXT);
+            packFolded(szText, entry.keyWords);
+            entry.pNode = pNode;
+            entry.iPosition = iPosition;
+            entry.iLength = static_cast<uint8_t>(szText.size());
+            entry.bItem = bItem;
+        }
+        iPosition++;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const TextEntry& left, const TextEntry& right)
+    {
+        int iOrder = compareTexts(left, right);
+        if(iOrder != 0) return iOrder < 0;
+        if(left.bItem != right.bItem) return right.bItem;
+        return left.iPosition < right.iPosition;
+    });
+
+    postings.reserve(entries.size());
+    for(size_t i = 0; i < entries.size(); i++)
+    {
+        bool bNewTerm = terms.empty() || entries[i - 1].bItem != entries[i].bItem || compareTexts(entries[i - 1], entries[i]) != 0;
+        if(bNewTerm)
+        {
+            std::string_view szText = textOf(entries[i]);
+            terms.push_back(Term{ static_cast<uint32_t>(szArena.size()), static_cast<uint32_t>(szText.size()),
+                                  static_cast<uint32_t>(postings.size()), 0, entries[i].bItem });
+            for(char c : szText) szArena.push_back(static_cast<char>(foldChar(c)));
+        }
+        terms.back().iPostings++;
+        postings.push_back(entries[i].pNode);
+    }
+    terms.shrink_to_fit();
+    szArena.shrink_to_fit();
+}
+
+/*********************************************************************
+size_t DeliverySearchIndex::search(std::string_view szQuery, size_t iMaxEdits, size_t iLimit, std::vector<SearchHit>& hits) const
+Purpose:
+    Finds deliveries whose name or item starts close to a query.
+Parameters:
+    I std::string_view szQuery - Text typed by the player
+    I size_t iMaxEdits - Most letters inserted, dropped or changed
+    I size_t iLimit - Most deliveries to return
+    O std::vector<SearchHit>& hits - Matches, closest first
+Return Value:
+    size_t - Number of hits
+Notes:
+    Runs one pass per edit count from 0 up, so exact prefixes come
+    first and the walk stops as soon as iLimit deliveries are found.
+    A delivery is listed once, under whichever field matched closest.
+*********************************************************************/
+size_t DeliverySearchIndex::search(std::string_view szQuery, size_t iMaxEdits, size_t iLimit, std::vector<SearchHit>& hits) const
+{
+    hits.clear();
+    char folded[MAX_QUERY];
+    size_t iQuery = (szQuery.size() < MAX_QUERY) ? szQuery.size() : MAX_QUERY;
+    for(size_t i = 0; i < iQuery; i++) folded[i] = static_cast<char>(foldChar(szQuery[i]));
+
+    uint8_t root[MAX_QUERY + 1];
+    for(size_t j = 0; j <= iQuery; j++) root[j] = static_cast<uint8_t>(j);
+
+    if(iMaxEdits > MAX_QUERY) iMaxEdits = MAX_QUERY;
+    Walk state{ std::string_view(folded, iQuery), 0, iLimit, &hits };
+    for(size_t iBound = 0; iBound <= iMaxEdits && hits.size() < iLimit && !terms.empty(); iBound++)
+    {
+        state.iBound = iBound;
+        walk(0, terms.size(), 0, root, state);
+    }
+    return hits.size();
+}
+
+/*********************************************************************
+void DeliverySearchIndex::walk(size_t iFirst, size_t iLast, size_t iDepth, const uint8_t* pRow, Walk& state) const
+Purpose:
+    Searches the terms below one prefix.
+Parameters:
+    I size_t iFirst - First term sharing the prefix
+    I size_t iLast - One past the last
+    I size_t iDepth - Length of the prefix
+    I const uint8_t* pRow - Edit distances from the prefix to each
+                            start of the query
+    I/O Walk& state - Query, bound and hits
+Return Value:
+    None
+Notes:
+    Once the whole query is within the bound every term below
+    matches. Otherwise each next letter gets its own row, and a
+    branch is dropped when no entry of it is within the bound, since
+    longer prefixes can only be further away.
+*********************************************************************/
+void DeliverySearchIndex::walk(size_t iFirst, size_t iLast, size_t iDepth, const uint8_t* pRow, Walk& state) const
+{
+    size_t iQuery = state.szQuery.size();
+    if(pRow[iQuery] <= state.iBound)
+    {
+        collect(iFirst, iLast, pRow[iQuery], state);
+        return;
+    }
+
+    size_t iTerm = iFirst;
+    while(iTerm < iLast && terms[iTerm].iLength == iDepth) iTerm++;
+
+    uint8_t row[MAX_QUERY + 1];
+    while(iTerm < iLast && state.pHits->size() < state.iLimit)
+    {
+        unsigned char c = charAt(iTerm, iDepth);
+        size_t iLow = iTerm + 1;
+        size_t iHigh = iLast;
+        while(iLow < iHigh)
+        {
+            size_t iMid = iLow + (iHigh - iLow) / 2;
+            if(charAt(iMid, iDepth) == c) iLow = iMid + 1;
+            else iHigh = iMid;
+        }
+
+        row[0] = static_cast<uint8_t>(pRow[0] + 1);
+        uint8_t iBest = row[0];
+        for(size_t j = 1; j <= iQuery; j++)
+        {
+            int iSubstitute = pRow[j - 1] + (static_cast<unsigned char>(state.szQuery[j - 1]) != c ? 1 : 0);
+            row[j] = static_cast<uint8_t>(std::min({ pRow[j] + 1, row[j - 1] + 1, iSubstitute }));
+            iBest = std::min(iBest, row[j]);
+        }
+        if(iBest <= state.iBound) walk(iTerm, iLow, iDepth + 1, row, state);
+        iTerm = iLow;
+    }
+}
+
+/*********************************************************************
+void DeliverySearchIndex::collect(size_t iFirst, size_t iLast, uint8_t iEdits, Walk& state) const
+Purpose:
+    Adds the deliveries of a range of matching terms.
+Parameters:
+    I size_t iFirst - First matching term
+    I size_t iLast - One past the last
+    I uint8_t iEdits - Their distance from the query
+    I/O Walk& state - Query, bound and hits
+Return Value:
+    None
+Notes:
+    Deliveries already listed are skipped; the list is at most
+    iLimit long.
+*********************************************************************/
+void DeliverySearchIndex::collect(size_t iFirst, size_t iLast, uint8_t iEdits, Walk& state) const
+{
+    std::vector<SearchHit>& hits = *state.pHits;
+    for(size_t iTerm = iFirst; iTerm < iLast; iTerm++)
+    {
+        const Term& term = terms[iTerm];
+        for(size_t i = term.iFirstPosting; i < term.iFirstPosting + term.iPostings; i++)
+        {
+            if(hits.size() >= state.iLimit) return;
+            const Delivery* pNode = postings[i];
+            bool bListed = std::any_of(hits.begin(), hits.end(), [pNode](const SearchHit& hit) { return hit.pNode == pNode; });
+            if(!bListed) hits.push_back(SearchHit{ pNode, iEdits, term.bItem });
+        }
+    }
+}
+
+/*********************************************************************
+size_t DeliverySearchIndex::footprintBytes() const
+Purpose:
+    Bytes held by the index.
+Parameters:
+    None
+Return Value:
+    size_t - Object, arena, terms and postings
+Notes:
+    None
+*********************************************************************/
+size_t DeliverySearchIndex::footprintBytes() const
+{
+    return sizeof(*this) + szArena.capacity() + terms.capacity() * sizeof(Term) + postings.capacity() * sizeof(const Delivery*);
+}
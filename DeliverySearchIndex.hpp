@@ -0,0 +1,107 @@
+/*********************************************************************
+File name: DeliverySearchIndex.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the DeliverySearchIndex class, which finds
+    deliveries from the start of a name or item, typos allowed.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for DeliverySearchIndex and struct definition
+    for SearchHit.
+Notes:
+    Backs the guessing menu's search option.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*********************************************************************
+Struct Name: SearchHit
+Purpose:
+    One delivery returned by DeliverySearchIndex::search().
+Notes:
+    None
+*********************************************************************/
+struct SearchHit
+{
+    const Delivery* pNode;   // Matching delivery
+    uint8_t iEdits;          // Letters the query is off from the text's start
+    bool bItem;              // Matched on the item rather than the name
+};
+
+/*********************************************************************
+Class Name: DeliverySearchIndex
+Purpose:
+    Prefix and bounded edit distance search over every name and item
+    in a manifest.
+Notes:
+    Distinct lowercased texts are kept sorted in one arena, which
+    makes them an implicit trie: the texts below a prefix are one
+    range, and each next letter splits it by binary search. A query
+    walks that trie carrying one row of the edit distance table, and
+    drops a branch as soon as every entry of its row is over the
+    bound. A text matches when some start of it is within the bound
+    of the whole query, so a query with 0 edits is a plain prefix
+    search. The index is a snapshot; compare getRevision() with the
+    manifest's and rebuild once deliveries are added or removed.
+*********************************************************************/
+class DeliverySearchIndex
+{
+    private:
+        /*********************************************************************
+        Struct Name: Term
+        Purpose:
+            One distinct text of one field and the deliveries with it.
+        *********************************************************************/
+        struct Term
+        {
+            uint32_t iOffset;          // Start of the lowercased text in szArena
+            uint32_t iLength;          // Its length
+            uint32_t iFirstPosting;    // First of its deliveries in postings
+            uint32_t iPostings;        // How many deliveries have it
+            bool bItem;                // Item text rather than a name
+        };
+
+        /*********************************************************************
+        Struct Name: Walk
+        Purpose:
+            State of one pass of search().
+        *********************************************************************/
+        struct Walk
+        {
+            std::string_view szQuery;           // Lowercased query
+            size_t iBound;                      // Edits allowed this pass
+            size_t iLimit;                      // Most hits wanted
+            std::vector<SearchHit>* pHits;      // Hits so far
+        };
+
+        std::string szArena;                    // Lowercased texts, in term order
+        std::vector<Term> terms;                // Sorted by text, then field
+        std::vector<const Delivery*> postings;  // Deliveries of each term, in list order
+        size_t iRevision;                       // Manifest revision the index reflects
+
+        unsigned char charAt(size_t iTerm, size_t iDepth) const { return static_cast<unsigned char>(szArena[terms[iTerm].iOffset + iDepth]); }
+        void walk(size_t iFirst, size_t iLast, size_t iDepth, const uint8_t* pRow, Walk& state) const;
+        void collect(size_t iFirst, size_t iLast, uint8_t iEdits, Walk& state) const;
+
+    public:
+        static const size_t MAX_QUERY = 64;     // Longer queries are cut to this
+        static const size_t MAX_TEXT = 255;     // Longer texts are indexed by their start
+
+        explicit DeliverySearchIndex(const AirshipOrderList& airshipOrderList);
+
+        size_t search(std::string_view szQuery, size_t iMaxEdits, size_t iLimit, std::vector<SearchHit>& hits) const;
+        size_t getRevision() const { return iRevision; }
+        size_t getTermCount() const { return terms.size(); }
+        size_t footprintBytes() const;
+};
@@ -13,56 +13,630 @@ Input:
 Results:
     Class definition for DisplayManager.
 Notes:
-    Contains story scenes and customer dialogue for the game.
+    Holds all story text, customer dialogues and game scenes as a
+    constexpr table, so a scene can be resolved at compile time.
 *********************************************************************/
 
 #pragma once
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*********************************************************************
+Enum Name: SceneId
+Purpose:
+    Identifies each scene in the display table.
+Notes:
+    Count must stay last.
+*********************************************************************/
+enum class SceneId : uint8_t
+{
+    Starting,
+    CustomerOne,
+    CustomerTwo,
+    CustomerThree,
+    CustomerFour,
+    CustomerFive,
+    CustomerSix,
+    Guessing,
+    Victory,
+    Losing,
+    Count
+};
+
+/*********************************************************************
+Namespace Name: SceneText
+Purpose:
+    Scene text and the table indexing it by SceneId.
+Notes:
+    Inline constexpr, so every file shares one copy of each view.
+*********************************************************************/
+namespace SceneText
+{
+    /*********************************************************************
+    STARTING_SCENE
+    Purpose:
+        Opening narrative and instructions for the player.
+    *********************************************************************/
+    inline constexpr std::string_view STARTING_SCENE = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#
+                   UUU         UUU         UUU             /\
+
+    )"
+R"(
+──────────────────────────────────────────────
+   SKYBORNE EXPRESS – DOCK 7, MIDNIGHT SHIFT
+──────────────────────────────────────────────
+
+Engines purr in the dark. Rain taps Morse on the hull. Six bookings tonight. 
+All flagged "priority." None look honest.
+
+Every slip has a name, an item, a quantity, and a cost. The system only trusts *exact* 
+entries. One wrong letter, one wrong digit, and a lie can hide in plain sight.
+
+[Radio crackle]
+
+DISPATCH: "Captain, heads up. HQ got a tip: one shipment's manifest is fraudulent. 
+Its price looks wrong on paper — not by much, but enough to put a target on our backs 
+if we load it."
+
+DISPATCH: "They like to talk, these six. Listen to what they say about each other, 
+cargo gossip's cheaper than insurance."
+
+DISPATCH: "And a few of them are fond of riddles now, for some reason. Note those too. 
+Between price, loose tongues, and riddles, you’ll spot the liar."
+
+You flip your clipboard open, pen hovering over the first line.
+
+Tonight, you *know* one shipment is lying. Your job is to find it and remove it before 
+the ramp closes.
+
+If something goes wrong tonight, your signature’s on it.
+)";
+
+    /*********************************************************************
+    CUSTOMER_ONE
+    Purpose:
+        Bulk Ryker's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_ONE = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /             
+           ~~~    / H          [H]          H \    ~~~      0       ()
+                 / _H_         _H_         _H_ \           /\#     {[]}
+                   UUU         UUU         UUU             /\      //\\
+
+    )"
+R"(
+──────────────────────────────────────────────
+   [January 17 – 00:12, Bulk Ryker Arrives]
+──────────────────────────────────────────────
+
+The hangar doors hiss open and a wall of muscle stomps through the rain. 
+Tank top, duffel bag, and an expression like the weather offended him.
+
+"BRO," he grunts. "Just got back from Mexico. Don't ask. DO. NOT. ASK."
+
+He drags his crate like it insulted his mother and lets it slam onto the deck.
+
+Bulk Ryker: "Protein Infusion Canisters. Four units. Cost: two hundred. 
+Best deal on the dock, bro. Nobody gets them cheaper than me."
+
+The number catches your ear. You’ve seen similar canisters. 
+They never come that cheap by a long shot.
+
+Bulk jerks his chin toward the programmer pacing near the back.
+
+Bulk Ryker: "But that programmer kid, Linton? Bro jitters like he drank twelve energy drinks 
+and forgot to breathe. Always muttering, eyes all bugged out. I wouldn’t trust him alone 
+with my gym bag, let alone a shipment."
+
+He cracks his neck, smirks, then adds:
+
+Bulk Ryker: "25 * 5 is 100"
+
+You log: 
+    Name: Bulk Ryker |
+    Item: Protein Infusion Canisters |
+    Qty: 4 |
+    Cost: 200 |
+)";
+
+    /*********************************************************************
+    CUSTOMER_TWO
+    Purpose:
+        Buck Hawthorne's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_TWO = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0     O
+                 / _H_         _H_         _H_ \           /\#  /(_)\
+                   UUU         UUU         UUU             /\    | | 
+
+    )"
+R"(
+──────────────────────────────────────────────
+ [January 17 – 00:47, Buck Hawthorne Arrives]
+──────────────────────────────────────────────
+
+He waddles in under a rain-slick jacket that does not quite close over his belly, 
+clutching a brown bottle of dock beer.
+
+Buck: "Back when I was young, crates were honest. Beer was cheaper. 
+Knees didn't hurt. Anyway, here's mine." He eases the crate down with a wheezy grunt.
+
+Buck: "Classic Ale Keg. One unit. Cost: ninety. Standard issue. 
+Back when I was young, that would've been thirty. But hey, inflation."
+
+The number sounds right. Nothing unusual there.
+
+He nods toward the conspiracy theorist, still clutching his notebook like evidence.
+
+Buck: "That Vesper boy? Smells like excuses, same scent my disappointing son used to drag 
+around after missing shift again. Hell, the kid even slouches the same. 
+But underneath all that jitter and talk of lights and triangles, he's solid. 
+If my ex-wife had given me custody, I reckon I'd've raised someone a lot like him
+rough edges, weird stories, but a good heart shoved in there anyway."
+
+Buck leans closer, voice dropping to a tipsy hush.
+
+Buck: "Here’s a little brain teaser for you, Captain:
+
+    'What has numbers but no weight, 
+     letters but no sound?'
+
+Back when I was young, we used that to haze the rookies."
+
+You log: 
+    Name: Buck Hawthorne |
+    Item: Classic Ale Keg |
+    Qty: 1 |
+    Cost: 90 |
+)";
+
+    /*********************************************************************
+    CUSTOMER_THREE
+    Purpose:
+        Old Man Ripple's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_THREE = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#   _O_
+                   UUU         UUU         UUU             /\     /\
+
+    )"
+R"(
+──────────────────────────────────────────────
+ [January 17 – 01:03, Old Man Ripple Arrives]
+──────────────────────────────────────────────
+
+He drifts out of the mist like he was poured from it. 
+Coat salt-stained, eyes cloudy, steps slow and sure.
+
+Ripple: "Evening, Captain. Sea spat me back out with a job to finish. 
+Funny thing ’bout tides—what leaves always comes back, 
+unless it doesn’t. Circle of something… you know."
+
+He pats the crate once, almost fondly, before resting it on the deck, 
+clearly convinced he’s just shared ancient ocean wisdom instead of damp confusion.
+
+Ripple: "Net-Stabilizer Kit. Two units. Cost: one hundred twenty."
+
+You’ve seen the same kits listed closer to one-eighty. His price feels… light.
+
+Ripple watches the big man pace grooves into the hangar floor.
+
+Ripple: "Bulk walks like a bar fight looking for a table to break. 
+Loud voice, louder footsteps, never still. That kind of energy capsizes calm crews. 
+I’ve seen whole voyages sink on men like him."
+
+He listens to the rain for a long moment, then adds, softer, like a tide going out:
+
+Ripple: 
+    "When two shadows stand, only one is true.  
+     The liar’s breath chills the page they touch."
+
+You log: 
+    Name: Old Man Ripple |
+    Item: Net-Stabilizer Kit |
+    Qty: 2 |
+    Cost: 120 |
+)";
+
+    /*********************************************************************
+    CUSTOMER_FOUR
+    Purpose:
+        Bramble Nett's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_FOUR = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#
+                   UUU         UUU         UUU             /\
+
+    )"
+R"(
+──────────────────────────────────────────────
+  [January 17 – 01:14, Bramble Nett Arrives]
+──────────────────────────────────────────────
+
+He moves like he is not entirely convinced the floor is real. Damp hair, half-smile, 
+eyes fixed on the ceiling lights as if checking their pulse.
+
+Bramble: "Mmm. Your dock hums tonight, Captain. Good soil. Good echoes. 
+And those lights? I won’t stop staring at ’em. Swear to god they’re breathing. 
+In… out… in… out… like they know we’re here."
+
+He lowers the crate with surprising care, like setting down a sleeping animal.
+
+Bramble: "Cultivation Spore Beds. Three units. Cost: one hundred fifty. Fair trade. The fungi approve."
+
+The number matches what you’ve seen before. Standard rate.
+
+His gaze drifts toward the old sailor listening to the rain as if it’s speaking back.
+
+Bramble: "Ripple carries storms in his bones, but his eyes? Those are deep roots. 
+He’s the sort who patches holes in other people’s ships without telling them. 
+If there’s anyone here I’d plant a secret with, it’s him."
+
+Bramble’s smile tilts, distant.
+
+Bramble:
+    "The quietest growth makes the loudest bloom 
+     when no one’s watching."
+
+You log: 
+    Name: Bramble Nett |
+    Item: Cultivation Spore Beds |
+    Qty: 3 |
+    Cost: 150 |
+)";
+
+    /*********************************************************************
+    CUSTOMER_FIVE
+    Purpose:
+        Vesper Morrow's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_FIVE = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#
+                   UUU         UUU         UUU             /\
+
+    )"
+R"(
+──────────────────────────────────────────────
+  [January 17 – 01:26, Vesper Morrow Arrives]
+──────────────────────────────────────────────
+
+He barrels in mid-sentence, rain plastering his hair to his head, 
+notebook clutched to his chest.
+
+Vesper: "—AND THAT’S WHEN THE DOGMAN STEPPED OUT OF THE TREE LINE, CAPTAIN. 
+Seven feet tall, glowing eyes, smelling like wet copper and bad omens. 
+Locking eyes with him? Absolute sign of the apocalypse. 
+Page forty-two of my notebook predicted this EXACT scenario."
+
+He sets the crate down like it might bite.
+
+Vesper: "EM Field Sensor. One unit. Cost: one hundred ten. Got a discount from a guy who was 
+absolutely beamed up last winter. You can tell in his eyes."
+
+You know EM sensors run more than twice that. The number itches at the back of your mind.
+
+His gaze snags on Buck, who is taking a slow pull from his bottle.
+
+Vesper: "That old-timer, Buck? Everyone acts like he’s harmless, but he’s always watching, 
+always listening, like he’s writing a report no one asked for. Folks who play that harmless 
+tend to know more than they should."
+
+He taps his notebook once, eyes bright.
+
+Vesper: "Patterns, Captain. The universe loves them. So do liars."
+
+You log: 
+    Name: Vesper Morrow |
+    Item: EM Field Sensor |
+    Qty: 1 |
+    Cost: 110 |
+)";
+
+    /*********************************************************************
+    CUSTOMER_SIX
+    Purpose:
+        Linton Yarrow's dialogue and delivery information.
+    *********************************************************************/
+    inline constexpr std::string_view CUSTOMER_SIX = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#
+                   UUU         UUU         UUU             /\
+
+    )"
+R"(
+──────────────────────────────────────────────
+  [January 17 – 01:39, Linton Yarrow Arrives]
+──────────────────────────────────────────────
+
+He arrives mid-mutter, fingers twitching like he is typing on an invisible keyboard.
+
+Linton: And for the record, Captain, I’ve decided encapsulation is overrated. 
+Everyone keeps telling me to ‘hide my data’ and ‘respect boundaries.’ 
+I say: make everything public. Let the world see the mess. 
+At least then no one’s surprised when it breaks."
+
+He adjusts the box with unnecessary fuss, then reads from his slip.
+
+Linton: "Soft-Code Debugging Array. One unit. Cost: three hundred twenty."
+
+You have seen arrays like that listed near nine hundred; even on the cheap end, his number runs low.
+
+He forces a laugh that does not quite land.
+
+Linton’s eyes flick to Bramble, still studying the ceiling like it’s growing something.
+
+Linton: "And that Bramble guy? Talks like a meditation app with a glitch. Nobody floats through life 
+that calm without hiding a subroutine or two. If anyone here’s running something in the background, 
+it’s him."
+
+He leans in, voice dropping.
+
+Linton: 
+    "A tool that finds mistakes 
+     cannot afford one of its own."
+
+You log: 
+    Name: Linton Yarrow |
+    Item: Soft-Code Debugging Array |
+    Qty: 1 |
+    Cost: 320 |
+)";
+
+    /*********************************************************************
+    GUESSING_SCENE
+    Purpose:
+        Scene where the player must identify the fraudulent package.
+    *********************************************************************/
+    inline constexpr std::string_view GUESSING_SCENE = R"(                 
+                 .                             .
+                //                             \\
+               //                               \\
+              //                                 \\
+             //                _._                \\
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /    
+           ~~~    / H          [H]          H \    ~~~      0
+                 / _H_         _H_         _H_ \           /\#
+                   UUU         UUU         UUU             /\
+
+)"
+R"(
+──────────────────────────────────────────────
+    [January 17 – 01:52, The Manifest Test]
+──────────────────────────────────────────────
+
+The rain slackens. The hangar lights buzz. You plant the six slips on the crate and listen.
+
+The mail pouch at your hip thrums—soft, then sharp— like a tuning fork near a lie.
+
+One shipment’s description isn’t honest.
+
+Some costs rang low. Some tongues pointed fingers. Some riddles curled around something nastier 
+than wordplay.
+
+You scan the names, the items, the quantities, the costs. Somewhere in the ink, one bad entry 
+waits to take the fall.
+
+Review the entries and delete the suspect's delivery:
+)";
+
+    /*********************************************************************
+    VICTORY_SCENE
+    Purpose:
+        Shown when the player removes the fraudulent package.
+    *********************************************************************/
+    inline constexpr std::string_view VICTORY_SCENE = R"(                 
+                  _
+                 -=\`\
+             |\ ____\_\__
+           -=\ `""""""" "`)
+              `----/ /~~`
+                -==/ /
+                  '-'
+
+                  _  _
+                 ( `   )_
+                (    )    `)
+              (_   (_ .  _) _)
+                                             _
+                                            (  )
+             _ .                         ( `  ) . )
+           (  _ )_                      (_, _(  ,_)_)
+         (_  _(_ ,)
+)"
+R"(
+──────────────────────────────────────────────
+     [January 17 – 02:07, Manifest Verified]
+──────────────────────────────────────────────
+
+The pouch on your hip gives one clean, steady hum a truth-note.
+
+You flip the final slip over, scribble your signature, and the hangar exhales with you.
+
+DISPATCH (radio): "Captain, HQ confirms it. Good call. That could’ve cost the entire dock."
+
+A soft clunk echoes as the loading clamps lock. Engines spool, hungry to leave.
+
+Bulk finally stops pacing. 
+Buck raises his bottle in a tired salute. 
+Ripple closes his eyes and listens to a storm that never arrives. 
+Bramble finaly stops staring at the wall.
+Vesper scans the sky for triangles and, for once, finds none. 
+Linton’s crate sits untouched, danger filed under 'averted.'
+
+Tonight, nothing blows up, phases out, lies, or sings.
+
+You earned your lift-off.
+
+✔ Manifest cleared  
+✔ Shipment secured  
+✔ Captain intact  
+
+Victory feels like a hangar finally going still.
+)";
+
+    /*********************************************************************
+    LOSING_SCENE
+    Purpose:
+        Shown when the player removes an honest package.
+    *********************************************************************/
+    inline constexpr std::string_view LOSING_SCENE = R"(                            * #** 
+                 .          **              .__      * ###*
+                //        **##**             \|_       *#*
+               //          *#* *               \\     **
+              //           **                    \\   *#
+             //             ** _._                \\ **
+          .---.              ./  |\\.             .---.             <O
+         / .-. \___    __..-~ _.-._ ~-..________ / .-. \_________    |\
+         \ ~-~ /   \        `-=.___.=-'          \ ~-~ /             /\
+_____/              
+)"
+R"(
+──────────────────────────────────────────────
+     [January 17 – 02:07, Manifest Failure]
+──────────────────────────────────────────────
+
+The pouch on your hip screeches—short, sharp, unmistakably wrong.
+
+Before you can flip the slip back over, the crate beside you *ticks* out of rhythm.
+
+Someone shouts. Something hums. Everything goes sideways.
+
+A flash of light bleeds through the metal like fog through fingers. 
+The air screams and the hangar lights pop, one by one.
+
+DISPATCH (radio, panicked): "Captain—Captain?!  
+You cleared the wrong manifest. Back away—"
+
+But it’s too late.
+
+The shipment you passed wasn’t honest. 
+And tonight, honesty was the only shield you had.
+
+✖ Manifest falsified  
+✖ HQ breach reported  
+✖ Plane compromised  
+
+The hangar falls silent, except for the rain
+tapping your mistake into the floor.
+)";
+
+    /*********************************************************************
+    SCENES
+    Purpose:
+        Every scene, indexed by SceneId.
+    *********************************************************************/
+    inline constexpr std::string_view SCENES[] = { STARTING_SCENE, CUSTOMER_ONE, CUSTOMER_TWO, CUSTOMER_THREE,
+                                            CUSTOMER_FOUR, CUSTOMER_FIVE, CUSTOMER_SIX, GUESSING_SCENE,
+                                            VICTORY_SCENE, LOSING_SCENE };
+    static_assert(sizeof(SCENES) / sizeof(SCENES[0]) == static_cast<size_t>(SceneId::Count),
+                  "every SceneId needs an entry in SCENES");
+
+    /*********************************************************************
+    constexpr std::string_view sceneText(SceneId id)
+    Purpose:
+        Compile-time lookup of a scene by id.
+    *********************************************************************/
+    constexpr std::string_view sceneText(SceneId id)
+    {
+        return SCENES[static_cast<size_t>(id)];
+    }
+
+    static_assert(sceneText(SceneId::CustomerOne).size() > 0 && sceneText(SceneId::Losing).size() > 0,
+                  "scene text is resolved at compile time");
+}
 
 /*********************************************************************
 Class Name: DisplayManager
 Purpose:
-    Manages and stores all display text for the Airship Delivery
-    System game including story scenes and customer dialogues.
+    Provides all display text for the Airship Delivery System game
+    including story scenes and customer dialogues.
 Notes:
-    All scenes are stored as strings and initialized in the constructor.
-    Getter methods provide read-only access to scene text.
+    Scenes are a constexpr table of string views in read-only data,
+    so constructing a DisplayManager allocates nothing. Getters return
+    views that stay valid for the life of the program.
 *********************************************************************/
 class DisplayManager
 {
-private:
-    std::string m_szStartingScene;  // Opening scene text
-    std::string m_szCustomerOne;    // Bulk Ryker scene text
-    std::string m_szCustomerTwo;    // Buck Hawthorne scene text
-    std::string m_szCustomerThree;  // Old Man Ripple scene text
-    std::string m_szCustomerFour;   // Bramble Nett scene text
-    std::string m_szCustomerFive;   // Vesper Morrow scene text
-    std::string m_szCustomerSix;    // Linton Yarrow scene text
-    std::string m_szGuessingScene;  // Guessing phase scene text
-    std::string m_szVictoryScene;   // Victory ending scene text
-    std::string m_szLosingScene;    // Losing ending scene text
-
-    void setStartingScene();
-    void setCustomerOne();
-    void setCustomerTwo();
-    void setCustomerThree();
-    void setCustomerFour();
-    void setCustomerFive();
-    void setCustomerSix();
-    void setGuessingScene();
-    void setVictoryScene();
-    void setLosingScene();
-
 public:
-    DisplayManager();
-    const std::string& getStartingScene()  const { return m_szStartingScene; }
-    const std::string& getCustomerOne()    const { return m_szCustomerOne; }
-    const std::string& getCustomerTwo()    const { return m_szCustomerTwo; }
-    const std::string& getCustomerThree()  const { return m_szCustomerThree; }
-    const std::string& getCustomerFour()   const { return m_szCustomerFour; }
-    const std::string& getCustomerFive()   const { return m_szCustomerFive; }
-    const std::string& getCustomerSix()    const { return m_szCustomerSix; }
-    const std::string& getGuessingScene()  const { return m_szGuessingScene; }
-    const std::string& getVictoryScene()   const { return m_szVictoryScene; }
-    const std::string& getLosingScene()   const { return m_szLosingScene; }
+    static constexpr std::string_view getScene(SceneId id) { return SceneText::sceneText(id); }
+    static constexpr std::string_view getCustomerScene(size_t iCustomer)
+    {
+        const size_t iCustomers = static_cast<size_t>(SceneId::CustomerSix) - static_cast<size_t>(SceneId::CustomerOne);
+        return getScene(static_cast<SceneId>(static_cast<size_t>(SceneId::CustomerOne) + (iCustomer < iCustomers ? iCustomer : iCustomers)));
+    }
+    std::string_view getStartingScene()  const { return getScene(SceneId::Starting); }
+    std::string_view getCustomerOne()    const { return getScene(SceneId::CustomerOne); }
+    std::string_view getCustomerTwo()    const { return getScene(SceneId::CustomerTwo); }
+    std::string_view getCustomerThree()  const { return getScene(SceneId::CustomerThree); }
+    std::string_view getCustomerFour()   const { return getScene(SceneId::CustomerFour); }
+    std::string_view getCustomerFive()   const { return getScene(SceneId::CustomerFive); }
+    std::string_view getCustomerSix()    const { return getScene(SceneId::CustomerSix); }
+    std::string_view getGuessingScene()  const { return getScene(SceneId::Guessing); }
+    std::string_view getVictoryScene()   const { return getScene(SceneId::Victory); }
+    std::string_view getLosingScene()    const { return getScene(SceneId::Losing); }
+    size_t footprintBytes() const;
+    static size_t textBytes();
 };
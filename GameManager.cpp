@@ -19,11 +19,138 @@ Notes:
 
 #include "GameManager.hpp"
 #include "DisplayManager.hpp"
+#include "ScenarioGenerator.hpp"
+#include "SceneFormatter.hpp"
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <iostream>
-#include <limits>
-#include <iomanip>
+#include <vector>
+
+namespace
+{
+    /*********************************************************************
+    const char CREW_STATEMENTS_LOG[]
+    Purpose:
+        Crew statements, price notes and riddles shown from the
+        guessing menu.
+    Notes:
+        Kept in read-only data and shared by every session.
+    *********************************************************************/
+    const char CREW_STATEMENTS_LOG[] = R"(
+──────────────────────────────────────────────
+               CREW STATEMENTS LOG
+──────────────────────────────────────────────
+
+
+[1] Bulk Ryker
+    Price Note:
+      Protein Infusion Canisters priced at 200 — you’ve seen
+      similar canisters and they never come that cheap.
+
+    Accusation:
+      Points at Linton: “Bro jitters like he drank twelve
+      energy drinks… I wouldn’t trust him alone with my gym bag.”
+
+    Riddle:
+      "25 * 5 is 100"
+
+
+[2] Buck Hawthorne
+    Price Note:
+      Classic Ale Keg priced at 90 — number sounds right.
+
+    Accusation:
+      Comments on Vesper: smells like excuses, reminds him of
+      his disappointing son, but deep down solid.
+
+    Riddle:
+      “What has numbers but no weight,
+       letters but no sound?”
+
+
+[3] Old Man Ripple
+    Price Note:
+      Net-Stabilizer Kit priced at 120 — you’ve seen them
+      closer to 180; his price feels light.
+
+    Accusation:
+      Says Bulk’s numbers feel lighter than his temper.
+
+    Riddle:
+      “When two shadows stand, only one is true.
+       The liar’s breath chills the page they touch.”
+
+
+[4] Bramble Nett
+    Price Note:
+      Cultivation Spore Beds priced at 150 — standard rate.
+
+    Accusation:
+      Says Buck’s crate smells honest; says Ripple is someone
+      he’d trust with a secret.
+
+    Riddle:
+      “The quietest growth makes the loudest bloom
+       when no one’s watching.”
+
+
+[5] Vesper Morrow
+    Price Note:
+      EM Field Sensor priced at 110 — you know they run more
+      than twice that.
+
+    Accusation:
+      Says Buck acts harmless but is always listening, knows
+      more than he should.
+
+    Riddle:
+      (None)
+
+
+[6] Linton Yarrow
+    Price Note:
+      Soft-Code Debugging Array priced at 320 — you’ve seen
+      arrays like it listed near 900.
+
+    Accusation:
+      Says Bramble talks like a meditation app with a glitch,
+      suspects he’s hiding a subroutine.
+
+    Riddle:
+      “A tool that finds mistakes
+       cannot afford one of its own.”
+)";
+
+    const size_t SCENARIO_STATEMENTS = 12;   // Customers listed in a scenario's statements log
+
+    /*********************************************************************
+    Struct Name: SceneScratch
+    Purpose:
+        Buffers reused to render generated customer scenes.
+    Notes:
+        One per thread, so sessions multiplexed on a thread share it
+        instead of each holding their own.
+    *********************************************************************/
+    struct SceneScratch
+    {
+        ScenarioOrder order;   // Customer being rendered
+        std::string szClues;   // Arrival, accusation and riddle text
+        std::string szScene;   // Rendered scene
+    };
+    thread_local SceneScratch sceneScratch;
+
+    /*********************************************************************
+    const SceneFormatter& customerFormatter()
+    Purpose:
+        Shared formatter for generated customer scenes.
+    *********************************************************************/
+    const SceneFormatter& customerFormatter()
+    {
+        static const SceneFormatter formatter;
+        return formatter;
+    }
+}
 
 /*********************************************************************
 GameManager::GameManager(AirshipOrderList& airshipOrderList)
@@ -32,228 +159,1078 @@ Purpose:
 Parameters:
     I/O AirshipOrderList& airshipOrderList - Reference to delivery list
 Return Value:
-    None (constructor)
+    None (constructor)
+Notes:
+    Reads player input from standard input.
+*********************************************************************/
+GameManager::GameManager(AirshipOrderList& airshipOrderList) :
+    GameManager(airshipOrderList, InputReader::standardInput()) {}
+
+/*********************************************************************
+GameManager::GameManager(AirshipOrderList& airshipOrderList, InputReader& input)
+Purpose:
+    Constructor that initializes the game manager with delivery list
+    and an input source.
+Parameters:
+    I/O AirshipOrderList& airshipOrderList - Reference to delivery list
+    I/O InputReader& input - Source of every player response
+Return Value:
+    None (constructor)
+Notes:
+    Writes to the shared standard output sink.
+*********************************************************************/
+GameManager::GameManager(AirshipOrderList& airshipOrderList, InputReader& input) :
+    GameManager(airshipOrderList, input, OutputSink::standardOutput()) {}
+
+/*********************************************************************
+GameManager::GameManager(AirshipOrderList& airshipOrderList, InputReader& input, OutputSink& output)
+Purpose:
+    Constructor that initializes the game manager with delivery list,
+    an input source and an output sink.
+Parameters:
+    I/O AirshipOrderList& airshipOrderList - Reference to delivery list
+    I/O InputReader& input - Source of every player response
+    I/O OutputSink& output - Destination of every line of game output
+Return Value:
+    None (constructor)
+Notes:
+    Ties the output to the input so each screen is flushed in one write
+    right before the game waits for a response.
+*********************************************************************/
+GameManager::GameManager(AirshipOrderList& airshipOrderList, InputReader& input, OutputSink& output) :
+    m_airshipOrderList(airshipOrderList), m_pInput(&input), m_out(&output)
+{
+    m_pPrevTied = m_pInput->tie(&m_out);
+}
+
+/*********************************************************************
+GameManager::GameManager(AirshipOrderList& airshipOrderList, OutputSink& output)
+Purpose:
+    Constructor for a session driven entirely through step().
+Parameters:
+    I/O AirshipOrderList& airshipOrderList - Reference to delivery list
+    I/O OutputSink& output - Destination of every line of game output
+Return Value:
+    None (constructor)
+Notes:
+    runShift() has no input to read and plays out as if the player
+    had stopped typing.
+*********************************************************************/
+GameManager::GameManager(AirshipOrderList& airshipOrderList, OutputSink& output) :
+    m_airshipOrderList(airshipOrderList), m_out(&output)
+{
+}
+
+/*********************************************************************
+GameManager::~GameManager()
+Purpose:
+    Destructor that flushes the last screen and unties the input.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    Restores whatever stream the input was tied to before.
+*********************************************************************/
+GameManager::~GameManager()
+{
+    m_out.flush();
+    if(m_pInput != nullptr) m_pInput->tie(m_pPrevTied);
+}
+
+/*********************************************************************
+void GameManager::start(const DisplayManager& displayManager, size_t iFirstCustomer)
+Purpose:
+    Begins a new shift and shows its first screen.
+Parameters:
+    I const DisplayManager& displayManager - Scene text, kept for the session
+    I size_t iFirstCustomer - Customers before this one are skipped
+Return Value:
+    None
+Notes:
+    The opening scene only plays for a fresh shift (iFirstCustomer 0).
+*********************************************************************/
+void GameManager::start(const DisplayManager& displayManager, size_t iFirstCustomer)
+{
+    TraceRecorder::Span span = traceSpan("start", "step");
+    m_pScenes = &displayManager;
+    m_state = GameState();
+    m_state.iCustomer = static_cast<uint32_t>(std::min(iFirstCustomer, customerCount()));
+
+    if(iFirstCustomer == 0)
+    {
+        TraceRecorder::Span render = traceSpan("opening scene", "render");
+        clearScreen();
+        m_out << m_pScenes->getStartingScene() << "\n";
+        promptContinue(GamePhase::ContinueToCustomer);
+    }
+    else
+    {
+        handleInput(nullptr);
+    }
+    flushOutput();
+}
+
+/*********************************************************************
+void GameManager::resume(const DisplayManager& displayManager, const GameState& state)
+Purpose:
+    Carries on a session saved with getState().
+Parameters:
+    I const DisplayManager& displayManager - Scene text, kept for the session
+    I const GameState& state - Saved position of the session
+Return Value:
+    None
+Notes:
+    The manifest must already hold the session's deliveries. Nothing
+    is printed; the player is still looking at the last screen.
+*********************************************************************/
+void GameManager::resume(const DisplayManager& displayManager, const GameState& state)
+{
+    m_pScenes = &displayManager;
+    m_state = state;
+    if(m_pTracer != nullptr) m_iPromptShownNs = m_pTracer->now();
+}
+
+/*********************************************************************
+void GameManager::step(const std::string& szInput)
+Purpose:
+    Feeds one line of player input to the session.
+Parameters:
+    I const std::string& szInput - Line typed, without its line ending
+Return Value:
+    None
+Notes:
+    Everything the line produces is flushed to the sink before
+    returning. Blank lines are ignored wherever a value is expected,
+    like the old blocking reads that skipped them. When tracing, the
+    time since the last screen was flushed is recorded as a player
+    span named after the prompt.
+*********************************************************************/
+void GameManager::step(const std::string& szInput)
+{
+    const char* pPhaseName = gamePhaseName(m_state.phase);
+    if(m_pTracer != nullptr) m_pTracer->record(pPhaseName, "player", m_iPromptShownNs, m_pTracer->now(), m_iTraceTrack);
+
+    TraceRecorder::Span span = traceSpan(pPhaseName, "step");
+    handleInput(&szInput);
+    flushOutput();
+}
+
+/*********************************************************************
+void GameManager::endOfInput()
+Purpose:
+    Tells the session the player has stopped typing.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Anything half entered is dropped and the shift runs straight to
+    its ending scene.
+*********************************************************************/
+void GameManager::endOfInput()
+{
+    if(m_pScenes == nullptr) return;
+
+    TraceRecorder::Span span = traceSpan("end of input", "step");
+    m_state.bInputEnded = true;
+    while(!isFinished())
+    {
+        handleInput(nullptr);
+    }
+    flushOutput();
+}
+
+/*********************************************************************
+void GameManager::runShift(const DisplayManager& displayManager, size_t iFirstCustomer)
+Purpose:
+    Plays a whole shift: opening, customers, guessing and ending.
+Parameters:
+    I const DisplayManager& displayManager - Scene text
+    I size_t iFirstCustomer - Customers before this one are skipped
+Return Value:
+    None
+Notes:
+    Blocks on the input reader between steps.
+*********************************************************************/
+void GameManager::runShift(const DisplayManager& displayManager, size_t iFirstCustomer)
+{
+    start(displayManager, iFirstCustomer);
+
+    std::string szLine;
+    while(!isFinished())
+    {
+        if(m_pInput != nullptr && m_pInput->readLine(szLine))
+        {
+            step(szLine);
+        }
+        else
+        {
+            endOfInput();
+        }
+    }
+}
+
+/*********************************************************************
+SceneTask<> GameManager::playShift(LineChannel& input, const DisplayManager& displayManager, size_t iFirstCustomer)
+Purpose:
+    Plays a whole shift as a coroutine: opening, customers, guessing
+    and ending.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+    I const DisplayManager& displayManager - Scene text, kept for the session
+    I size_t iFirstCustomer - Customers before this one are skipped
+Return Value:
+    SceneTask<> - Finishes once the ending scene has been shown
+Notes:
+    Suspends whenever the next line has not arrived yet. Closing the
+    channel abandons anything half entered, like endOfInput(). The
+    output is byte for byte what runShift() prints for the same lines.
+*********************************************************************/
+SceneTask<> GameManager::playShift(LineChannel& input, const DisplayManager& displayManager, size_t iFirstCustomer)
+{
+    m_pScenes = &displayManager;
+    m_state = GameState();
+    m_state.iCustomer = static_cast<uint32_t>(std::min(iFirstCustomer, customerCount()));
+
+    if(iFirstCustomer == 0)
+    {
+        {
+            TraceRecorder::Span render = traceSpan("opening scene", "render");
+            clearScreen();
+            m_out << m_pScenes->getStartingScene() << "\n";
+        }
+        promptContinue(GamePhase::ContinueToCustomer);
+        co_await nextLine(input);
+    }
+
+    while(m_state.iCustomer < customerCount() && !m_state.bInputEnded)
+    {
+        co_await runCustomerScene(input);
+    }
+    clearEntry();
+    if(!m_state.bInputEnded)
+    {
+        co_await runGuessingScene(input);
+    }
+    showEndingScene();
+    flushOutput();
+}
+
+/*********************************************************************
+SceneTask<> GameManager::runCustomerScene(LineChannel& input)
+Purpose:
+    Shows the next customer and records the delivery the player
+    enters for them.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+Return Value:
+    SceneTask<> - Finishes once the player continues, or input ends
+Notes:
+    Nothing is recorded if input ends before the cost is entered.
+*********************************************************************/
+SceneTask<> GameManager::runCustomerScene(LineChannel& input)
+{
+    showCustomerScene();
+    std::optional<std::string> name = co_await promptText(input, GamePhase::CargoName);
+    if(!name) co_return;
+    m_state.szName = std::move(*name);
+
+    m_out << szLineSpacing << "Item Description: ";
+    std::optional<std::string> item = co_await promptText(input, GamePhase::CargoItem);
+    if(!item) co_return;
+    m_state.szItem = std::move(*item);
+
+    m_out << szLineSpacing << "Quantity (units): ";
+    std::optional<int> quantity = co_await promptQuantity(input, GamePhase::CargoQuantity);
+    if(!quantity) co_return;
+    m_state.iQuantity = *quantity;
+
+    m_out << szLineSpacing << "Declared Value (credits): ";
+    std::optional<Credits> cost = co_await promptCost(input, GamePhase::CargoCost);
+    if(!cost) co_return;
+    m_state.cost = *cost;
+
+    recordDelivery();
+    promptContinue(GamePhase::ContinueToCustomer);
+    co_await nextLine(input);
+}
+
+/*********************************************************************
+SceneTask<> GameManager::runGuessingScene(LineChannel& input)
+Purpose:
+    Runs the guessing menu until a package is deleted or input ends.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+Return Value:
+    SceneTask<> - Finishes when the ending scene is due
+Notes:
+    Each choice is the same action handleGuessChoice() and
+    handleGuessItem() carry out one step at a time.
+*********************************************************************/
+SceneTask<> GameManager::runGuessingScene(LineChannel& input)
+{
+    while(true)
+    {
+        showGuessingMenu();
+        int iChoice = co_await promptChoice(input);
+        m_state.iAction = static_cast<uint8_t>((iChoice >= 1 && iChoice <= 7) ? iChoice : 0);
+
+        if(iChoice == 2 || iChoice == 3 || iChoice == 5)
+        {
+            if(iChoice == 3)
+            {
+                m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+                m_out << szLineSpacing << "               MODIFY DELIVERY\n";
+                m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+            }
+            m_out << szLineSpacing << "Please Enter Delivery Name: ";
+            std::optional<std::string> name = co_await promptText(input, GamePhase::GuessName);
+            if(!name) co_return;
+            m_state.szName = std::move(*name);
+
+            m_out << szLineSpacing << "Please Enter Item Name: ";
+            std::optional<std::string> item = co_await promptText(input, GamePhase::GuessItem);
+            if(!item) co_return;
+            m_state.szItem = std::move(*item);
+        }
+
+        switch(iChoice)
+        {
+            case 1:
+            {
+                TraceRecorder::Span render = traceSpan("crew statements", "render");
+                if(m_pScenario != nullptr)
+                {
+                    showScenarioStatements();
+                }
+                else
+                {
+                    m_out << CREW_STATEMENTS_LOG << "\n";
+                }
+                break;
+            }
+            case 2:
+                findDelivery();
+                break;
+            case 3:
+            {
+                m_out << szLineSpacing << "Please Enter New Quantity: ";
+                std::optional<int> quantity = co_await promptQuantity(input, GamePhase::ModifyQuantity);
+                if(!quantity) co_return;
+                m_state.iQuantity = *quantity;
+
+                m_out << szLineSpacing << "Please Enter New Cost: ";
+                std::optional<Credits> cost = co_await promptCost(input, GamePhase::ModifyCost);
+                if(!cost) co_return;
+                m_state.cost = *cost;
+                modifyDelivery();
+                break;
+            }
+            case 4:
+            {
+                TraceRecorder::Span list = traceSpan("display", "list");
+                m_airshipOrderList.displayDeliveries(m_out);
+                break;
+            }
+            case 5:
+            {
+                Delivery* delivery = nullptr;
+                {
+                    TraceRecorder::Span list = traceSpan("find", "list");
+                    delivery = m_airshipOrderList.findDelivery(m_state.szName, m_state.szItem);
+                }
+                if(delivery == nullptr)
+                {
+                    m_out << szLineSpacing << "Delivery Not Found\n";
+                    break;
+                }
+                m_out << "\n";
+                m_airshipOrderList.displayDelivery(delivery, m_out);
+                m_out << "\n";
+                m_out << szLineSpacing << "Are You Sure This Is The Fraudulent Package? (y/n): ";
+                std::optional<std::string> answer = co_await promptText(input, GamePhase::RemoveConfirm);
+                if(answer && (*answer)[0] == 'y')
+                {
+                    removeDelivery();
+                }
+                else
+                {
+                    m_out << szLineSpacing << "Aborting Package Removal\n";
+                }
+                break;
+            }
+            case 6:
+                undoModification();
+                break;
+            case 7:
+            {
+                m_out << szLineSpacing << "Search For (start of a name or item): ";
+                std::optional<std::string> query = co_await promptText(input, GamePhase::SearchQuery);
+                if(!query) co_return;
+                m_state.szName = std::move(*query);
+                searchDeliveries();
+                break;
+            }
+            default:
+                m_out << szLineSpacing << "Please Enter Valid Input\n";
+                break;
+        }
+
+        promptContinue(GamePhase::ContinueToGuess);
+        co_await nextLine(input);
+        if(m_state.bHasRemovedPackage || m_state.bInputEnded) co_return;
+    }
+}
+
+/*********************************************************************
+SceneTask<std::optional<std::string>> GameManager::promptText(LineChannel& input, GamePhase phase)
+Purpose:
+    Waits for a non-blank answer to the prompt just shown.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+    I GamePhase phase - Prompt being answered
+Return Value:
+    SceneTask<std::optional<std::string>> - The answer without leading
+        whitespace, or nullopt once input has ended
+Notes:
+    Blank lines are ignored, like the state machine does.
+*********************************************************************/
+SceneTask<std::optional<std::string>> GameManager::promptText(LineChannel& input, GamePhase phase)
+{
+    m_state.phase = phase;
+    while(true)
+    {
+        std::optional<std::string> line = co_await nextLine(input);
+        if(!line) co_return std::nullopt;
+
+        size_t iTextStart = InputReader::skipSpace(*line);
+        if(iTextStart < line->size()) co_return line->substr(iTextStart);
+    }
+}
+
+/*********************************************************************
+SceneTask<std::optional<int>> GameManager::promptQuantity(LineChannel& input, GamePhase phase)
+Purpose:
+    Waits for a positive quantity.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+    I GamePhase phase - Prompt being answered
+Return Value:
+    SceneTask<std::optional<int>> - The quantity, or nullopt once
+        input has ended
+Notes:
+    Re-prompts until the quantity is a positive integer.
+*********************************************************************/
+SceneTask<std::optional<int>> GameManager::promptQuantity(LineChannel& input, GamePhase phase)
+{
+    while(true)
+    {
+        std::optional<std::string> line = co_await promptText(input, phase);
+        if(!line) co_return std::nullopt;
+
+        int iQuantity = 0;
+        if(parseInt(*line, iQuantity) && iQuantity > 0) co_return iQuantity;
+        m_out << szLineSpacing << "Invalid number. Enter a positive integer: ";
+    }
+}
+
+/*********************************************************************
+SceneTask<std::optional<Credits>> GameManager::promptCost(LineChannel& input, GamePhase phase)
+Purpose:
+    Waits for a non-negative cost.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+    I GamePhase phase - Prompt being answered
+Return Value:
+    SceneTask<std::optional<Credits>> - The cost, or nullopt once
+        input has ended
+Notes:
+    Re-prompts until the cost is non-negative.
+*********************************************************************/
+SceneTask<std::optional<Credits>> GameManager::promptCost(LineChannel& input, GamePhase phase)
+{
+    while(true)
+    {
+        std::optional<std::string> line = co_await promptText(input, phase);
+        if(!line) co_return std::nullopt;
+
+        Credits cost;
+        if(parseCredits(*line, cost) && cost >= Credits()) co_return cost;
+        m_out << szLineSpacing << "Invalid amount. Enter a valid cost: ";
+    }
+}
+
+/*********************************************************************
+SceneTask<int> GameManager::promptChoice(LineChannel& input)
+Purpose:
+    Waits for a guessing menu choice.
+Parameters:
+    I/O LineChannel& input - Lines the player sends
+Return Value:
+    SceneTask<int> - The number typed, or 0 once input has ended
+Notes:
+    Non-numeric input re-prompts.
+*********************************************************************/
+SceneTask<int> GameManager::promptChoice(LineChannel& input)
+{
+    while(true)
+    {
+        std::optional<std::string> line = co_await promptText(input, GamePhase::GuessChoice);
+        if(!line) co_return 0;
+
+        int iChoice = 0;
+        if(parseInt(*line, iChoice)) co_return iChoice;
+        m_out << "\nInvalid input. Please enter a number.\n\n";
+        m_out << "Enter choice: ";
+    }
+}
+
+/*********************************************************************
+std::optional<std::string> GameManager::receiveLine(std::optional<std::string> line)
+Purpose:
+    Takes delivery of a line awaited by a scene.
+Parameters:
+    I std::optional<std::string> line - Line typed, or nullopt once
+        input has ended
+Return Value:
+    std::optional<std::string> - The same line
+Notes:
+    When tracing, the time since the screen was flushed is recorded
+    as a player span named after the prompt, as step() does.
+*********************************************************************/
+std::optional<std::string> GameManager::receiveLine(std::optional<std::string> line)
+{
+    if(!line)
+    {
+        m_state.bInputEnded = true;
+    }
+    else if(m_pTracer != nullptr)
+    {
+        m_pTracer->record(gamePhaseName(m_state.phase), "player", m_iPromptShownNs, m_pTracer->now(), m_iTraceTrack);
+    }
+    return line;
+}
+
+/*********************************************************************
+void GameManager::handleInput(const std::string* pLine)
+Purpose:
+    Advances the state machine by one input.
+Parameters:
+    I const std::string* pLine - Line typed, or nullptr once input has ended
+Return Value:
+    None
+Notes:
+    A nullptr input abandons any delivery, modification or search
+    half typed, so nothing is recorded from values never entered, and
+    goes to the ending. Menu prompts treat it as an invalid answer.
+*********************************************************************/
+void GameManager::handleInput(const std::string* pLine)
+{
+    if(m_pScenes == nullptr) return;
+    if(pLine == nullptr && m_state.phase != GamePhase::ContinueToCustomer && m_state.phase != GamePhase::GuessChoice &&
+       m_state.phase != GamePhase::RemoveConfirm && m_state.phase != GamePhase::ContinueToGuess &&
+       m_state.phase != GamePhase::Finished)
+    {
+        enterGuessing();
+        return;
+    }
+
+    size_t iTextStart = (pLine != nullptr) ? InputReader::skipSpace(*pLine) : 0;
+    bool bIsBlank = (pLine != nullptr && iTextStart == pLine->size());
+
+    switch(m_state.phase)
+    {
+        case GamePhase::ContinueToCustomer:
+            if(m_state.iCustomer < customerCount() && !m_state.bInputEnded)
+            {
+                showCustomerScene();
+            }
+            else
+            {
+                enterGuessing();
+            }
+            break;
+        case GamePhase::CargoName:
+            if(bIsBlank) return;
+            m_state.szName.assign(*pLine, iTextStart, std::string::npos);
+            m_out << szLineSpacing << "Item Description: ";
+            m_state.phase = GamePhase::CargoItem;
+            break;
+        case GamePhase::CargoItem:
+            if(bIsBlank) return;
+            m_state.szItem.assign(*pLine, iTextStart, std::string::npos);
+            m_out << szLineSpacing << "Quantity (units): ";
+            m_state.phase = GamePhase::CargoQuantity;
+            break;
+        case GamePhase::CargoQuantity:
+            if(bIsBlank) return;
+            handleCargoQuantity(*pLine);
+            break;
+        case GamePhase::CargoCost:
+            if(bIsBlank) return;
+            handleCargoCost(*pLine);
+            break;
+        case GamePhase::GuessChoice:
+            if(bIsBlank) return;
+            handleGuessChoice(pLine);
+            break;
+        case GamePhase::GuessName:
+            if(bIsBlank) return;
+            m_state.szName.assign(*pLine, iTextStart, std::string::npos);
+            m_out << szLineSpacing << "Please Enter Item Name: ";
+            m_state.phase = GamePhase::GuessItem;
+            break;
+        case GamePhase::GuessItem:
+            if(bIsBlank) return;
+            m_state.szItem.assign(*pLine, iTextStart, std::string::npos);
+            handleGuessItem();
+            break;
+        case GamePhase::ModifyQuantity:
+            if(bIsBlank) return;
+            handleModifyQuantity(*pLine);
+            break;
+        case GamePhase::ModifyCost:
+            if(bIsBlank) return;
+            handleModifyCost(*pLine);
+            break;
+        case GamePhase::RemoveConfirm:
+            if(bIsBlank) return;
+            handleRemoveConfirm(pLine);
+            break;
+        case GamePhase::ContinueToGuess:
+            if(m_state.bHasRemovedPackage || m_state.bInputEnded)
+            {
+                showEndingScene();
+            }
+            else
+            {
+                showGuessingMenu();
+            }
+            break;
+        case GamePhase::SearchQuery:
+            if(bIsBlank) return;
+            m_state.szName.assign(*pLine, iTextStart, std::string::npos);
+            searchDeliveries();
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
+        case GamePhase::Finished:
+            break;
+    }
+}
+
+/*********************************************************************
+void GameManager::showCustomerScene()
+Purpose:
+    Displays the next customer scene and opens the cargo terminal.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Clears screen, displays scene, prompts for the sender's name.
+*********************************************************************/
+void GameManager::showCustomerScene()
+{
+    TraceRecorder::Span span = traceSpan("customer scene", "render");
+    clearEntry();
+
+    clearScreen();
+    if(m_pScenario != nullptr)
+    {
+        CustomerProfile profile = m_pScenario->profile(m_state.iCustomer, sceneScratch.order, sceneScratch.szClues);
+        customerFormatter().render(profile, sceneScratch.szScene);
+        m_out << sceneScratch.szScene << "\n";
+    }
+    else
+    {
+        m_out << m_pScenes->getCustomerScene(m_state.iCustomer) << "\n";
+    }
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+    m_out << szLineSpacing << "         CARGO MANIFEST ENTRY TERMINAL\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    m_out << szLineSpacing << "Captain, input the following details carefully.\n";
+    m_out << szLineSpacing << "One wrong digit and insurance will have your head.\n\n";
+    m_out << szLineSpacing << "Customer / Sender Name: ";
+    m_state.phase = GamePhase::CargoName;
+}
+
+/*********************************************************************
+void GameManager::showScenarioStatements()
+Purpose:
+    Lists what the first generated customers said.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Stands in for the crew statements log when a scenario is set.
+    Only the first SCENARIO_STATEMENTS customers are listed.
+*********************************************************************/
+void GameManager::showScenarioStatements()
+{
+    m_out << "\n──────────────────────────────────────────────\n";
+    m_out << "               CREW STATEMENTS LOG\n";
+    m_out << "──────────────────────────────────────────────\n\n";
+
+    size_t iListed = std::min(customerCount(), SCENARIO_STATEMENTS);
+    for(size_t iCustomer = 0; iCustomer < iListed; iCustomer++)
+    {
+        CustomerProfile profile = m_pScenario->profile(iCustomer, sceneScratch.order, sceneScratch.szClues);
+        m_out << "\n[" << iCustomer + 1 << "] " << profile.szName << "\n";
+        m_out << "    Price Note:\n      " << profile.szItem << " priced at " << Credits::fromDouble(profile.dCost) << "\n\n";
+        m_out << "    Accusation:\n      " << profile.szAccusation << "\n\n";
+        m_out << "    Riddle:\n      " << (profile.szRiddle.empty() ? std::string_view("(None)") : profile.szRiddle) << "\n\n";
+    }
+    if(customerCount() > iListed)
+    {
+        m_out << "...and " << customerCount() - iListed << " more statements on file.\n";
+    }
+}
+
+/*********************************************************************
+void GameManager::handleCargoQuantity(const std::string& szLine)
+Purpose:
+    Accepts the units of a new delivery.
+Parameters:
+    I const std::string& szLine - Line typed
+Return Value:
+    None
+Notes:
+    Re-prompts until the quantity is a positive integer.
+*********************************************************************/
+void GameManager::handleCargoQuantity(const std::string& szLine)
+{
+    bool bValid = parseInt(szLine, m_state.iQuantity);
+    if(!bValid || m_state.iQuantity <= 0)
+    {
+        m_out << szLineSpacing << "Invalid number. Enter a positive integer: ";
+        return;
+    }
+    m_out << szLineSpacing << "Declared Value (credits): ";
+    m_state.phase = GamePhase::CargoCost;
+}
+
+/*********************************************************************
+void GameManager::handleCargoCost(const std::string& szLine)
+Purpose:
+    Accepts the value of a new delivery and records it.
+Parameters:
+    I const std::string& szLine - Line typed
+Return Value:
+    None
+Notes:
+    Re-prompts until the cost is non-negative.
+*********************************************************************/
+void GameManager::handleCargoCost(const std::string& szLine)
+{
+    bool bValid = parseCredits(szLine, m_state.cost);
+    if(!bValid || m_state.cost < Credits())
+    {
+        m_out << szLineSpacing << "Invalid amount. Enter a valid cost: ";
+        return;
+    }
+    recordDelivery();
+    promptContinue(GamePhase::ContinueToCustomer);
+}
+
+/*********************************************************************
+void GameManager::recordDelivery()
+Purpose:
+    Adds the delivery entered for the current customer to the manifest.
+Parameters:
+    None
+Return Value:
+    None
 Notes:
-    Initializes the catalog by calling setCatalog().
+    The delivery is logged first when a manifest log is attached.
+    Moves on to the next customer.
 *********************************************************************/
-GameManager::GameManager(AirshipOrderList& airshipOrderList) : m_airshipOrderList(airshipOrderList)
+void GameManager::recordDelivery()
 {
-    setCatalog();
+    m_out << "\n" << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    m_out << szLineSpacing << "Recording shipment...\n";
+    m_out << szLineSpacing << "Sender:  " << m_state.szName << "\n";
+    m_out << szLineSpacing << "Cargo:   " << m_state.szItem << "\n";
+    m_out << szLineSpacing << "Units:   " << m_state.iQuantity << "\n";
+    m_out << szLineSpacing << "Value:   " << m_state.cost << " credits\n\n";
+
+    {
+        TraceRecorder::Span list = traceSpan("add", "list");
+        if(m_pManifestLog != nullptr) checkLogged(m_pManifestLog->logAdd(m_state.szName, m_state.szItem, m_state.iQuantity, m_state.cost));
+        m_airshipOrderList.addDelivery(m_state.szName, m_state.szItem, m_state.iQuantity, m_state.cost);
+    }
+    m_state.iCustomer++;
 }
 
 /*********************************************************************
-void GameManager::runStartingScene(const std::string& szScene)
+void GameManager::clearEntry()
 Purpose:
-    Displays the starting scene and waits for user to continue.
+    Forgets the name, item, quantity and cost typed so far.
 Parameters:
-    I const std::string& szScene - Starting scene text to display
+    None
 Return Value:
     None
 Notes:
-    Clears screen before displaying scene.
+    None
 *********************************************************************/
-void GameManager::runStartingScene(const std::string& szScene)
+void GameManager::clearEntry()
 {
-    clearScreen();
-    std::cout << szScene << "\n";
-    promptNextCustomerScene();
+    m_state.szName.clear();
+    m_state.szItem.clear();
+    m_state.iQuantity = 0;
+    m_state.cost = Credits();
 }
 
 /*********************************************************************
-void GameManager::runCustomerScene(const std::string& szScene)
+void GameManager::enterGuessing()
 Purpose:
-    Displays a customer scene, prompts for cargo input, and continues.
+    Moves from the last customer to the guessing phase.
 Parameters:
-    I const std::string& szScene - Customer scene text to display
+    None
 Return Value:
     None
 Notes:
-    Clears screen, displays scene, prompts for delivery entry.
+    Goes straight to the ending if input has already run out.
 *********************************************************************/
-void GameManager::runCustomerScene(const std::string& szScene)
+void GameManager::enterGuessing()
 {
-    clearScreen();
-    std::cout << szScene << "\n";
-    promptCargoInput();
-    promptNextCustomerScene();
+    clearEntry();
+
+    if(m_state.bInputEnded)
+    {
+        showEndingScene();
+    }
+    else
+    {
+        showGuessingMenu();
+    }
 }
 
 /*********************************************************************
-void GameManager::runEndingScene(const std::string& szScene)
+void GameManager::showGuessingMenu()
 Purpose:
-    Displays the ending scene (victory or defeat).
+    Displays the guessing scene and its menu.
 Parameters:
-    I const std::string& szScene - Ending scene text to display
+    None
 Return Value:
     None
 Notes:
-    Clears screen before displaying the final scene.
+    Presents 7 options: view catalog, find, modify, display, delete,
+    undo last modification, search.
 *********************************************************************/
-void GameManager::runEndingScene(const std::string& szScene)
+void GameManager::showGuessingMenu()
 {
+    TraceRecorder::Span span = traceSpan("guessing menu", "render");
     clearScreen();
-    std::cout << szScene << "\n";
+    m_out << m_pScenes->getGuessingScene() << "\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    m_out << szLineSpacing << "1. View Catalog\n";
+    m_out << szLineSpacing << "2. Find Delivery\n";
+    m_out << szLineSpacing << "3. Modify Delivery\n";
+    m_out << szLineSpacing << "4. Display Deliveries\n";
+    m_out << szLineSpacing << "5. Delete Delivery\n";
+    m_out << szLineSpacing << "6. Undo Last Modification\n";
+    m_out << szLineSpacing << "7. Search Deliveries\n\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    m_out << szLineSpacing << "Enter Choice: ";
+    m_out << "Enter choice: ";
+    m_state.phase = GamePhase::GuessChoice;
 }
 
 /*********************************************************************
-void GameManager::runGuessingScene(const std::string& szScene)
+void GameManager::handleGuessChoice(const std::string* pLine)
 Purpose:
-    Manages the guessing phase where player identifies fraudulent package.
+    Carries out a guessing menu choice.
 Parameters:
-    I const std::string& szScene - Guessing scene text to display
+    I const std::string* pLine - Line typed, or nullptr once input has ended
 Return Value:
     None
 Notes:
-    Loops until player removes a package, provides menu for various actions.
+    Non-numeric input re-prompts; once input has ended the choice is
+    0, which is reported as invalid.
 *********************************************************************/
-void GameManager::runGuessingScene(const std::string& szScene)
+void GameManager::handleGuessChoice(const std::string* pLine)
 {
-    int iChoice;
-    while(!bHasRemovedPackage)
+    int iChoice = 0;
+    if(pLine != nullptr && !parseInt(*pLine, iChoice))
     {
-        clearScreen();
-        std::cout << szScene << "\n";
-        iChoice = promptGuessingScene();
-        switch(iChoice)
-        {
-            case 1:
-                std::cout << szCatalog << "\n";
-                break;
-
-            case 2:
-                promptFindDelivery();
-                break;
-
-            case 3:
-                promptModifyDelivery();
-                break;
-
-            case 4:
-                m_airshipOrderList.displayDeliveries();
-                break;
-
-            case 5:
-                promptRemoveDelivery();
-                break;
+        m_out << "\nInvalid input. Please enter a number.\n\n";
+        m_out << "Enter choice: ";
+        return;
+    }
 
-            default:
-                std::cout << szLineSpacing << "Please Enter Valid Input\n";
-                break;
+    m_state.iAction = static_cast<uint8_t>((iChoice >= 1 && iChoice <= 7) ? iChoice : 0);
+    switch(iChoice)
+    {
+        case 1:
+        {
+            TraceRecorder::Span render = traceSpan("crew statements", "render");
+            if(m_pScenario != nullptr)
+            {
+                showScenarioStatements();
+            }
+            else
+            {
+                m_out << CREW_STATEMENTS_LOG << "\n";
+            }
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
+        }
+        case 3:
+            m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+            m_out << szLineSpacing << "               MODIFY DELIVERY\n";
+            m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+            // fall through
+        case 2:
+        case 5:
+            m_out << szLineSpacing << "Please Enter Delivery Name: ";
+            m_state.phase = GamePhase::GuessName;
+            break;
+        case 4:
+        {
+            TraceRecorder::Span list = traceSpan("display", "list");
+            m_airshipOrderList.displayDeliveries(m_out);
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
         }
-        promptNextCustomerScene();
+        case 6:
+            undoModification();
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
+        case 7:
+            m_out << szLineSpacing << "Search For (start of a name or item): ";
+            m_state.phase = GamePhase::SearchQuery;
+            break;
+        default:
+            m_out << szLineSpacing << "Please Enter Valid Input\n";
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
     }
 }
 
 /*********************************************************************
-int GameManager::promptGuessingScene()
+void GameManager::handleGuessItem()
 Purpose:
-    Displays the guessing scene menu and gets user choice.
+    Continues a find, modify or delete once its delivery is named.
 Parameters:
     None
 Return Value:
-    int - User's menu choice
+    None
 Notes:
-    Presents 5 options: view catalog, find, modify, display, delete.
+    None
 *********************************************************************/
-int GameManager::promptGuessingScene()
+void GameManager::handleGuessItem()
 {
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
-    std::cout << szLineSpacing << "1. View Catalog\n";
-    std::cout << szLineSpacing << "2. Find Delivery\n";
-    std::cout << szLineSpacing << "3. Modify Delivery\n";
-    std::cout << szLineSpacing << "4. Display Deliveries\n";
-    std::cout << szLineSpacing << "5. Delete Delivery\n\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
-    std::cout << szLineSpacing << "Enter Choice: ";
-    int iChoice = getChoice();
-    return iChoice;
+    switch(m_state.iAction)
+    {
+        case 2:
+            findDelivery();
+            promptContinue(GamePhase::ContinueToGuess);
+            break;
+        case 3:
+            m_out << szLineSpacing << "Please Enter New Quantity: ";
+            m_state.phase = GamePhase::ModifyQuantity;
+            break;
+        default:
+        {
+            TraceRecorder::Span list = traceSpan("find", "list");
+            Delivery* delivery = m_airshipOrderList.findDelivery(m_state.szName, m_state.szItem);
+            if(delivery == nullptr)
+            {
+                m_out << szLineSpacing << "Delivery Not Found\n";
+                promptContinue(GamePhase::ContinueToGuess);
+                return;
+            }
+
+            m_out << "\n";
+            m_airshipOrderList.displayDelivery(delivery, m_out);
+            m_out << "\n";
+            m_out << szLineSpacing << "Are You Sure This Is The Fraudulent Package? (y/n): ";
+            m_state.phase = GamePhase::RemoveConfirm;
+            break;
+        }
+    }
 }
 
 /*********************************************************************
-int GameManager::getChoice()
+void GameManager::handleModifyQuantity(const std::string& szLine)
 Purpose:
-    Gets and validates integer input from user.
+    Accepts the new quantity for a modification.
 Parameters:
-    None
+    I const std::string& szLine - Line typed
 Return Value:
-    int - Valid integer choice from user
+    None
 Notes:
-    Loops until valid integer is entered, clears invalid input.
+    Re-prompts until the quantity is a positive integer.
 *********************************************************************/
-int GameManager::getChoice()
+void GameManager::handleModifyQuantity(const std::string& szLine)
 {
-    int iChoice;
-
-    while (true)
+    bool bValid = parseInt(szLine, m_state.iQuantity);
+    if(!bValid || m_state.iQuantity <= 0)
     {
-        std::cout << "Enter choice: ";
-        if (std::cin >> iChoice)
-        {
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            return iChoice;
-        }
-
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-        std::cout << "\nInvalid input. Please enter a number.\n\n";
+        m_out << szLineSpacing << "Invalid number. Enter a positive integer: ";
+        return;
     }
+    m_out << szLineSpacing << "Please Enter New Cost: ";
+    m_state.phase = GamePhase::ModifyCost;
 }
 
 /*********************************************************************
-void GameManager::promptNameAndItem()
+void GameManager::handleModifyCost(const std::string& szLine)
 Purpose:
-    Prompts user for customer name and item name.
+    Accepts the new cost for a modification and applies it.
 Parameters:
-    None
+    I const std::string& szLine - Line typed
 Return Value:
     None
 Notes:
-    Stores input in member variables m_szName and m_szItem.
+    Re-prompts until the cost is non-negative.
 *********************************************************************/
-void GameManager::promptNameAndItem()
+void GameManager::handleModifyCost(const std::string& szLine)
 {
-    std::cout << szLineSpacing << "Please Enter Delivery Name: ";
-    std::getline(std::cin >> std::ws, m_szName);
-    std::cout << szLineSpacing << "Please Enter Item Name: ";
-    std::getline(std::cin >> std::ws, m_szItem);
+    bool bValid = parseCredits(szLine, m_state.cost);
+    if(!bValid || m_state.cost < Credits())
+    {
+        m_out << szLineSpacing << "Invalid amount. Enter a valid cost: ";
+        return;
+    }
+    modifyDelivery();
+    promptContinue(GamePhase::ContinueToGuess);
 }
 
 /*********************************************************************
-void GameManager::promptQuantityAndCost()
+void GameManager::handleRemoveConfirm(const std::string* pLine)
 Purpose:
-    Prompts user for quantity and cost with input validation.
+    Deletes the named delivery if the player confirms.
 Parameters:
-    None
+    I const std::string* pLine - Line typed, or nullptr once input has ended
 Return Value:
     None
 Notes:
-    Validates positive quantity and non-negative cost, stores in members.
+    Anything but 'y' aborts. Deleting any package ends the guessing
+    phase; the guess is correct if it was the fraudulent one.
 *********************************************************************/
-void GameManager::promptQuantityAndCost()
+void GameManager::handleRemoveConfirm(const std::string* pLine)
 {
-    std::cout << szLineSpacing << "Please Enter New Quantity: ";
-    while (!(std::cin >> m_iQuantity) || m_iQuantity <= 0)
+    char cInput = 'n';
+    if(pLine != nullptr) cInput = (*pLine)[InputReader::skipSpace(*pLine)];
+
+    if(cInput != 'y')
     {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << szLineSpacing << "Invalid number. Enter a positive integer: ";
+        m_out << szLineSpacing << "Aborting Package Removal\n";
     }
-
-    std::cout << szLineSpacing << "Please Enter New Cost: ";
-    while (!(std::cin >> m_dCost) || m_dCost < 0.0)
+    else
     {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << szLineSpacing << "Invalid amount. Enter a valid cost: ";
+        removeDelivery();
     }
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    promptContinue(GamePhase::ContinueToGuess);
 }
 
 /*********************************************************************
-void GameManager::promptFindDelivery()
+void GameManager::findDelivery()
 Purpose:
-    Prompts for delivery info and displays if found.
+    Displays the named delivery if it is on the manifest.
 Parameters:
     None
 Return Value:
@@ -261,276 +1238,256 @@ Return Value:
 Notes:
     Searches for delivery by name and item, displays result.
 *********************************************************************/
-void GameManager::promptFindDelivery()
+void GameManager::findDelivery()
 {
-    promptNameAndItem();
-    Delivery* delivery = m_airshipOrderList.findDelivery(m_szName, m_szItem);
+    TraceRecorder::Span span = traceSpan("find", "list");
+    Delivery* delivery = m_airshipOrderList.findDelivery(m_state.szName, m_state.szItem);
     if(delivery == nullptr)
     {
-        std::cout << szLineSpacing << "Delivery Not Found\n";
+        m_out << szLineSpacing << "Delivery Not Found\n";
         return;
     }
-
-    std::cout << "\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-    std::cout << szLineSpacing << "               DELIVERY FOUND\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
-    m_airshipOrderList.displayDelivery(delivery);
-    std::cout << "\n";
+    m_out << "\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+    m_out << szLineSpacing << "               DELIVERY FOUND\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    m_airshipOrderList.displayDelivery(delivery, m_out);
+    m_out << "\n";
 }
 
 /*********************************************************************
-void GameManager::promptModifyDelivery()
+void GameManager::modifyDelivery()
 Purpose:
-    Prompts for delivery info and modifies quantity and cost.
+    Updates the named delivery's quantity and cost.
 Parameters:
     None
 Return Value:
     None
 Notes:
-    Finds delivery and updates quantity and cost if found.
+    Keeps the delivery's old quantity and cost so the change can be
+    undone. A modify only touches those two fields, so that one record
+    is the whole difference from the previous manifest.
 *********************************************************************/
-void GameManager::promptModifyDelivery()
+void GameManager::modifyDelivery()
 {
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-    std::cout << szLineSpacing << "               MODIFY DELIVERY\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
-
-    promptNameAndItem();
-    promptQuantityAndCost();
-
-    bool bIsModified = m_airshipOrderList.modifyDelivery(m_szName, m_szItem, m_iQuantity, m_dCost);
-    if(!bIsModified)
+    TraceRecorder::Span span = traceSpan("modify", "list");
+    Delivery* delivery = m_airshipOrderList.findDelivery(m_state.szName, m_state.szItem);
+    if(delivery == nullptr)
     {
-        std::cout << szLineSpacing << "Failed To Modify Delivery\n";
+        m_out << szLineSpacing << "Failed To Modify Delivery\n";
         return;
     }
-    std::cout << szLineSpacing << "Delivery Successfully Modified\n\n";
+
+    DeliveryRecord before;
+    before.szName = m_state.szName;
+    before.szItem = m_state.szItem;
+    before.iQuantity = delivery->iQuantity;
+    before.cost = delivery->cost;
+
+    m_airshipOrderList.modifyDelivery(m_state.szName, m_state.szItem, m_state.iQuantity, m_state.cost);
+    if(m_pManifestLog != nullptr) checkLogged(m_pManifestLog->logModify(m_state.szName, m_state.szItem, m_state.iQuantity, m_state.cost));
+
+    m_state.undoRecord = std::move(before);
+    m_state.bHasUndo = true;
+    m_out << szLineSpacing << "Delivery Successfully Modified\n\n";
 }
 
 /*********************************************************************
-void GameManager::promptRemoveDelivery()
+void GameManager::undoModification()
 Purpose:
-    Prompts for delivery to remove and confirms with user.
+    Rolls the manifest back to before the last modification.
 Parameters:
     None
 Return Value:
     None
 Notes:
-    Validates delivery exists, confirms removal, checks if correct package.
+    Only one level of undo is kept. Writes the saved quantity and cost
+    back with one modify, the same cost as the change it reverts.
 *********************************************************************/
-void GameManager::promptRemoveDelivery()
+void GameManager::undoModification()
 {
-    promptNameAndItem();
-    Delivery* delivery = m_airshipOrderList.findDelivery(m_szName, m_szItem);
-    if(delivery == nullptr)
+    TraceRecorder::Span span = traceSpan("undo", "list");
+    if(!m_state.bHasUndo)
     {
-        std::cout << szLineSpacing << "Delivery Not Found\n";
+        m_out << szLineSpacing << "Nothing To Undo\n";
         return;
     }
 
-    std::cout << "\n";
-    m_airshipOrderList.displayDelivery(delivery);
-    std::cout << "\n";
+    const DeliveryRecord& undo = m_state.undoRecord;
+    m_airshipOrderList.modifyDelivery(undo.szName, undo.szItem, undo.iQuantity, undo.cost);
+    if(m_pManifestLog != nullptr) checkLogged(m_pManifestLog->logModify(undo.szName, undo.szItem, undo.iQuantity, undo.cost));
+    m_state.bHasUndo = false;
+    m_out << szLineSpacing << "Last Modification Undone\n\n";
+}
 
-    char cInput;
-    std::cout << szLineSpacing << "Are You Sure This Is The Fraudulent Package? (y/n): ";
-    std::cin >> cInput;
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-    if(cInput != 'y')
-    {
-        std::cout << szLineSpacing << "Aborting Package Removal\n";
-        return;
-    }
+/*********************************************************************
+void GameManager::checkLogged(uint64_t iLsn)
+Purpose:
+    Warns the player when a manifest change did not reach the log.
+Parameters:
+    I uint64_t iLsn - Sequence number the log returned, 0 on failure
+Return Value:
+    None
+Notes:
+    The change still applies to the manifest; it just would not be
+    recovered after a crash.
+*********************************************************************/
+void GameManager::checkLogged(uint64_t iLsn)
+{
+    if(iLsn != 0) return;
+    m_out << szLineSpacing << "Warning: Manifest Log Write Failed, This Change Is Not Saved\n";
+}
 
-    bool bIsRemoved = m_airshipOrderList.removeDelivery(m_szName, m_szItem);
+/*********************************************************************
+void GameManager::removeDelivery()
+Purpose:
+    Deletes the named delivery and scores the guess.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void GameManager::removeDelivery()
+{
+    TraceRecorder::Span span = traceSpan("remove", "list");
+    bool bIsRemoved = m_airshipOrderList.removeDelivery(m_state.szName, m_state.szItem);
     if(!bIsRemoved)
     {
-        std::cout << szLineSpacing << "Issue Removing Package\n";
+        m_out << szLineSpacing << "Issue Removing Package\n";
         return;
     }
+    if(m_pManifestLog != nullptr) checkLogged(m_pManifestLog->logRemove(m_state.szName, m_state.szItem));
 
-    std::cout << szLineSpacing << "Package Successfully Removed\n\n";
-    bHasRemovedPackage = true;
-    (m_szName == m_fraudulentPackageName) ? bIsGuessCorrect = true : bIsGuessCorrect = false;
+    m_out << szLineSpacing << "Package Successfully Removed\n\n";
+    m_state.bHasRemovedPackage = true;
+    m_state.bIsGuessCorrect = (m_pScenario != nullptr) ? m_pScenario->isFraudulentName(m_state.szName)
+                                                       : (m_state.szName == m_fraudulentPackageName);
 }
 
 /*********************************************************************
-void GameManager::promptCargoInput()
+void GameManager::searchDeliveries()
 Purpose:
-    Prompts user to enter a new delivery into the system.
+    Lists deliveries whose name or item starts like the search text.
 Parameters:
     None
 Return Value:
     None
 Notes:
-    Validates input and adds delivery to the order list.
+    Allows one typo from 4 letters and two from 8, so players can
+    find a half-remembered customer before using Find or Delete with
+    the exact name. The index is rebuilt only after the manifest has
+    changed since the last search.
 *********************************************************************/
-void GameManager::promptCargoInput()
+void GameManager::searchDeliveries()
 {
-    std::string szCustomer;
-    std::string szItem;
-    int iQuantity = 0;
-    double dCost = 0.0;
-
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-    std::cout << szLineSpacing << "         CARGO MANIFEST ENTRY TERMINAL\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n\n";
-
-    std::cout << szLineSpacing << "Captain, input the following details carefully.\n";
-    std::cout << szLineSpacing << "One wrong digit and insurance will have your head.\n\n";
-
-    std::cout << szLineSpacing << "Customer / Sender Name: ";
-    std::getline(std::cin >> std::ws, szCustomer);
+    TraceRecorder::Span span = traceSpan("search", "list");
+    if(m_pSearchIndex == nullptr || m_pSearchIndex->getRevision() != m_airshipOrderList.getRevision())
+    {
+        m_pSearchIndex.reset(new DeliverySearchIndex(m_airshipOrderList));
+    }
 
-    std::cout << szLineSpacing << "Item Description: ";
-    std::getline(std::cin >> std::ws, szItem);
+    size_t iLength = m_state.szName.size();
+    size_t iMaxEdits = (iLength >= 8) ? 2 : ((iLength >= 4) ? 1 : 0);
+    std::vector<SearchHit> hits;
+    m_pSearchIndex->search(m_state.szName, iMaxEdits, SEARCH_RESULTS, hits);
 
-    std::cout << szLineSpacing << "Quantity (units): ";
-    while (!(std::cin >> iQuantity) || iQuantity <= 0)
+    m_out << "\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+    m_out << szLineSpacing << "               SEARCH RESULTS\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n\n";
+    if(hits.empty())
     {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << szLineSpacing << "Invalid number. Enter a positive integer: ";
+        m_out << szLineSpacing << "No Deliveries Match\n\n";
+        return;
     }
-
-    std::cout << szLineSpacing << "Declared Value (credits): ";
-    while (!(std::cin >> dCost) || dCost < 0.0)
+    for(const SearchHit& hit : hits)
     {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << szLineSpacing << "Invalid amount. Enter a valid cost: ";
+        m_out << szLineSpacing << hit.pNode->szName << " - " << hit.pNode->szItem;
+        if(hit.iEdits > 0) m_out << "  (" << static_cast<int>(hit.iEdits) << (hit.iEdits == 1 ? " letter" : " letters") << " off)";
+        m_out << "\n";
     }
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-    std::cout << "\n" << szLineSpacing << "──────────────────────────────────────────────\n\n";
-    std::cout << szLineSpacing << "Recording shipment...\n";
-    std::cout << szLineSpacing << "Sender:  " << szCustomer << "\n";
-    std::cout << szLineSpacing << "Cargo:   " << szItem << "\n";
-    std::cout << szLineSpacing << "Units:   " << iQuantity << "\n";
-    std::cout << szLineSpacing << "Value:   " << std::fixed << std::setprecision(2)
-              << dCost << " credits\n\n";
-    m_airshipOrderList.addDelivery(szCustomer, szItem, iQuantity, dCost);
+    m_out << "\n" << szLineSpacing << "Use Find or Delete with the exact name and item.\n\n";
 }
 
 /*********************************************************************
-void GameManager::promptNextCustomerScene()
+void GameManager::showEndingScene()
 Purpose:
-    Prompts user to press enter to continue to next scene.
+    Displays the ending scene (victory or defeat).
 Parameters:
     None
 Return Value:
     None
 Notes:
-    Pauses execution until user presses enter.
+    Clears screen before displaying the final scene.
 *********************************************************************/
-void GameManager::promptNextCustomerScene()
+void GameManager::showEndingScene()
 {
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-    std::cout << szLineSpacing << "             PRESS ENTER TO CONINTUE\n";
-    std::cout << szLineSpacing << "──────────────────────────────────────────────\n";
-
-    std::string iUserInput;
-    std::getline(std::cin, iUserInput);
+    TraceRecorder::Span span = traceSpan("ending scene", "render");
+    clearScreen();
+    if(m_state.bIsGuessCorrect == true)
+    {
+        m_out << m_pScenes->getVictoryScene() << "\n";
+    }
+    else
+    {
+        m_out << m_pScenes->getLosingScene() << "\n";
+    }
+    m_state.phase = GamePhase::Finished;
 }
 
 /*********************************************************************
-void GameManager::setCatalog()
+void GameManager::promptContinue(GamePhase next)
 Purpose:
-    Initializes the catalog string with crew statements and clues.
+    Asks the player to press enter before moving on.
 Parameters:
-    None
+    I GamePhase next - Phase that the next line continues from
 Return Value:
     None
 Notes:
-    Contains all customer information, price notes, and riddles.
+    Any line, empty or not, continues.
 *********************************************************************/
-void GameManager::setCatalog()
+void GameManager::promptContinue(GamePhase next)
 {
-    szCatalog = R"(
-──────────────────────────────────────────────
-               CREW STATEMENTS LOG
-──────────────────────────────────────────────
-
-
-[1] Bulk Ryker
-    Price Note:
-      Protein Infusion Canisters priced at 200 — you’ve seen
-      similar canisters and they never come that cheap.
-
-    Accusation:
-      Points at Linton: “Bro jitters like he drank twelve
-      energy drinks… I wouldn’t trust him alone with my gym bag.”
-
-    Riddle:
-      "25 * 5 is 100"
-
-
-[2] Buck Hawthorne
-    Price Note:
-      Classic Ale Keg priced at 90 — number sounds right.
-
-    Accusation:
-      Comments on Vesper: smells like excuses, reminds him of
-      his disappointing son, but deep down solid.
-
-    Riddle:
-      “What has numbers but no weight,
-       letters but no sound?”
-
-
-[3] Old Man Ripple
-    Price Note:
-      Net-Stabilizer Kit priced at 120 — you’ve seen them
-      closer to 180; his price feels light.
-
-    Accusation:
-      Says Bulk’s numbers feel lighter than his temper.
-
-    Riddle:
-      “When two shadows stand, only one is true.
-       The liar’s breath chills the page they touch.”
-
-
-[4] Bramble Nett
-    Price Note:
-      Cultivation Spore Beds priced at 150 — standard rate.
-
-    Accusation:
-      Says Buck’s crate smells honest; says Ripple is someone
-      he’d trust with a secret.
-
-    Riddle:
-      “The quietest growth makes the loudest bloom
-       when no one’s watching.”
-
-
-[5] Vesper Morrow
-    Price Note:
-      EM Field Sensor priced at 110 — you know they run more
-      than twice that.
-
-    Accusation:
-      Says Buck acts harmless but is always listening, knows
-      more than he should.
-
-    Riddle:
-      (None)
-
-
-[6] Linton Yarrow
-    Price Note:
-      Soft-Code Debugging Array priced at 320 — you’ve seen
-      arrays like it listed near 900.
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+    m_out << szLineSpacing << "             PRESS ENTER TO CONINTUE\n";
+    m_out << szLineSpacing << "──────────────────────────────────────────────\n";
+    m_state.phase = next;
+}
 
-    Accusation:
-      Says Bramble talks like a meditation app with a glitch,
-      suspects he’s hiding a subroutine.
+/*********************************************************************
+void GameManager::setScenario(const ScenarioGenerator* pScenario)
+Purpose:
+    Plays a generated scenario instead of the six written customers.
+Parameters:
+    I const ScenarioGenerator* pScenario - Scenario, or nullptr for the
+                                           written shift
+Return Value:
+    None
+Notes:
+    Call before start(). The scenario must outlive the session.
+*********************************************************************/
+void GameManager::setScenario(const ScenarioGenerator* pScenario)
+{
+    m_pScenario = pScenario;
+    if(m_pScenario != nullptr) m_fraudulentPackageName = m_pScenario->getFraudulentName();
+}
 
-    Riddle:
-      “A tool that finds mistakes
-       cannot afford one of its own.”
-)";
+/*********************************************************************
+size_t GameManager::customerCount() const
+Purpose:
+    Customer scenes in this shift.
+Parameters:
+    None
+Return Value:
+    size_t - The scenario's size, or six for the written shift
+Notes:
+    None
+*********************************************************************/
+size_t GameManager::customerCount() const
+{
+    return (m_pScenario != nullptr) ? m_pScenario->size() : CUSTOMER_COUNT;
 }
 
 /*********************************************************************
@@ -547,8 +1504,85 @@ Notes:
 void GameManager::clearScreen()
 {
 #ifdef _win32
+    m_out.flush();
     std::system("cls");
 #else
-    std::cout << "\033[2j\033[3j\033[h" << std::flush;
+    m_out << "\033[2j\033[3j\033[h";
 #endif
 }
+
+/*********************************************************************
+SessionFootprint GameManager::getFootprint() const
+Purpose:
+    Reports the memory held by this game and its manifest.
+Parameters:
+    None
+Return Value:
+    SessionFootprint - Game, state and manifest bytes
+Notes:
+    Scene text and the crew statements log are shared and not counted.
+*********************************************************************/
+SessionFootprint GameManager::getFootprint() const
+{
+    SessionFootprint footprint;
+    footprint.iGameBytes = sizeof(*this);
+    footprint.iStateBytes = m_state.heapBytes();
+    footprint.iManifestBytes = m_airshipOrderList.footprintBytes() + (m_pSearchIndex ? m_pSearchIndex->footprintBytes() : 0);
+    return footprint;
+}
+
+/*********************************************************************
+void GameManager::flushOutput()
+Purpose:
+    Sends the screen built so far to the output sink.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Marks when the player was shown the prompt, for player spans.
+*********************************************************************/
+void GameManager::flushOutput()
+{
+    {
+        TraceRecorder::Span span = traceSpan("flush", "output");
+        m_out.flush();
+    }
+    if(m_pTracer != nullptr) m_iPromptShownNs = m_pTracer->now();
+}
+
+/*********************************************************************
+bool GameManager::parseInt(const std::string& szLine, int& iValue)
+Purpose:
+    Parses a typed integer, traced as parse work.
+Parameters:
+    I const std::string& szLine - Line typed
+    O int& iValue - Parsed value, untouched on failure
+Return Value:
+    bool - True if the line started with a number
+Notes:
+    See InputReader::parseInt().
+*********************************************************************/
+bool GameManager::parseInt(const std::string& szLine, int& iValue)
+{
+    TraceRecorder::Span span = traceSpan("parseInt", "parse");
+    return InputReader::parseInt(szLine, iValue);
+}
+
+/*********************************************************************
+bool GameManager::parseCredits(const std::string& szLine, Credits& value)
+Purpose:
+    Parses a typed amount, traced as parse work.
+Parameters:
+    I const std::string& szLine - Line typed
+    O Credits& value - Parsed amount, untouched on failure
+Return Value:
+    bool - True if the line started with an amount
+Notes:
+    See InputReader::parseCredits().
+*********************************************************************/
+bool GameManager::parseCredits(const std::string& szLine, Credits& value)
+{
+    TraceRecorder::Span span = traceSpan("parseCredits", "parse");
+    return InputReader::parseCredits(szLine, value);
+}
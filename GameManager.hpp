@@ -19,49 +19,141 @@ Notes:
 #pragma once
 #include "DisplayManager.hpp"
 #include "AirshipOrderList.hpp"
+#include "DeliverySearchIndex.hpp"
+#include "GameState.hpp"
+#include "InputReader.hpp"
+#include "ManifestLog.hpp"
+#include "OutputSink.hpp"
+#include "SceneTask.hpp"
+#include "SessionFootprint.hpp"
+#include "TraceRecorder.hpp"
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <ostream>
 #include <string>
 
+class ScenarioGenerator;
+
 /*********************************************************************
 Class Name: GameManager
 Purpose:
     Controls game flow, manages user interactions, and coordinates
     between display and delivery management systems.
 Notes:
-    Handles all game logic, input validation, and scene transitions.
-    Maintains reference to AirshipOrderList for delivery operations.
+    The game is a state machine driven one input line at a time:
+    start() shows the first screen, and each step() consumes a line,
+    updates the manifest and writes the next screen, flushing it to
+    the output sink before returning. Nothing blocks, so one thread
+    can drive any number of sessions. runShift() is the blocking
+    loop that feeds lines from an InputReader. playShift() plays the
+    same shift as a coroutine instead: its scenes and prompts
+    co_await lines from a LineChannel and read top to bottom like the
+    story, sharing every rule and screen with the state machine. With
+    a TraceRecorder attached, rendering, parsing, list operations and
+    output flushes are recorded as spans, along with the time the
+    player spent on each prompt. With a ScenarioGenerator set, its
+    customers replace the six hand-written ones and any of its
+    planted frauds wins.
 *********************************************************************/
 class GameManager
 {
     private:
         const char* szLineSpacing = "";                            // Line spacing for formatted output
-        std::string szCatalog;                                     // Catalog of crew statements and clues
         AirshipOrderList& m_airshipOrderList;                     // Reference to delivery list
+        InputReader* m_pInput = nullptr;                           // Source of player input for runShift()
+        std::ostream m_out;                                        // Formatted output, buffered by an OutputSink
+        std::ostream* m_pPrevTied = nullptr;                       // Stream m_pInput was tied to before this game
+        const DisplayManager* m_pScenes = nullptr;                 // Scene text, set by start()
+        const ScenarioGenerator* m_pScenario = nullptr;            // Generated customers in place of the six
         std::string m_fraudulentPackageName = "Linton Yarrow";    // Name of fraudulent package customer
-        std::string m_szName;                                      // Temporary storage for customer name
-        std::string m_szItem;                                      // Temporary storage for item name
-        int m_iQuantity;                                           // Temporary storage for quantity
-        double m_dCost;                                            // Temporary storage for cost
-        bool bHasRemovedPackage = false;                           // Flag indicating if package removed
-        bool bIsGuessCorrect = false;                              // Flag indicating if correct package removed
+        GameState m_state;                                         // Where the session is
+        ManifestLog* m_pManifestLog = nullptr;                     // Optional write-ahead log of manifest changes
+        TraceRecorder* m_pTracer = nullptr;                        // Optional span recorder
+        uint32_t m_iTraceTrack = 0;                                // Track this session's spans go on
+        uint64_t m_iPromptShownNs = 0;                             // When the last screen was flushed, for player spans
+        std::unique_ptr<DeliverySearchIndex> m_pSearchIndex;       // Built by the first search, rebuilt once the manifest changes
+
+        static const size_t CUSTOMER_COUNT = 6;                    // Customer scenes in the written shift
+        static const size_t SEARCH_RESULTS = 10;                   // Most deliveries a search lists
+
+        /*********************************************************************
+        Struct Name: InputAwaiter
+        Purpose:
+            Awaits a scene's next line: flushes the screen first, then
+            hands the line on through receiveLine().
+        *********************************************************************/
+        struct InputAwaiter
+        {
+            GameManager& game;
+            LineChannel::Awaiter line;
+
+            bool await_ready() { game.flushOutput(); return line.await_ready(); }
+            void await_suspend(std::coroutine_handle<> coroutine) { line.await_suspend(coroutine); }
+            std::optional<std::string> await_resume() { return game.receiveLine(line.await_resume()); }
+        };
 
     private:
-        int promptGuessingScene();
-        int getChoice();
-        void promptNameAndItem();
-        void promptQuantityAndCost();
-        void promptCargoInput();
-        void promptFindDelivery();
-        void promptModifyDelivery();
-        void promptRemoveDelivery();
-        void promptNextCustomerScene();
-        void setCatalog();
+        void handleInput(const std::string* pLine);
+        void showCustomerScene();
+        void showScenarioStatements();
+        size_t customerCount() const;
+        void showGuessingMenu();
+        void showEndingScene();
+        void promptContinue(GamePhase next);
+        void handleCargoQuantity(const std::string& szLine);
+        void handleCargoCost(const std::string& szLine);
+        void handleGuessChoice(const std::string* pLine);
+        void handleGuessItem();
+        void handleModifyQuantity(const std::string& szLine);
+        void handleModifyCost(const std::string& szLine);
+        void handleRemoveConfirm(const std::string* pLine);
+        void recordDelivery();
+        void clearEntry();
+        void enterGuessing();
+        void findDelivery();
+        void modifyDelivery();
+        void removeDelivery();
+        void searchDeliveries();
+        void undoModification();
+        void checkLogged(uint64_t iLsn);
         void clearScreen();
+        void flushOutput();
+        bool parseInt(const std::string& szLine, int& iValue);
+        bool parseCredits(const std::string& szLine, Credits& value);
+        TraceRecorder::Span traceSpan(const char* pName, const char* pCategory) { return TraceRecorder::Span(m_pTracer, pName, pCategory, m_iTraceTrack); }
+
+        InputAwaiter nextLine(LineChannel& input) { return InputAwaiter{*this, input.next()}; }
+        std::optional<std::string> receiveLine(std::optional<std::string> line);
+        SceneTask<> runCustomerScene(LineChannel& input);
+        SceneTask<> runGuessingScene(LineChannel& input);
+        SceneTask<std::optional<std::string>> promptText(LineChannel& input, GamePhase phase);
+        SceneTask<std::optional<int>> promptQuantity(LineChannel& input, GamePhase phase);
+        SceneTask<std::optional<Credits>> promptCost(LineChannel& input, GamePhase phase);
+        SceneTask<int> promptChoice(LineChannel& input);
 
     public:
         GameManager(AirshipOrderList& airshipOrderList);
-        void runStartingScene(const std::string& szScene);
-        void runCustomerScene(const std::string& szScene);
-        void runGuessingScene(const std::string& szScene);
-        void runEndingScene(const std::string& szScene);
-        bool getIsGuessCorrect() { return bIsGuessCorrect; }
+        GameManager(AirshipOrderList& airshipOrderList, InputReader& input);
+        GameManager(AirshipOrderList& airshipOrderList, InputReader& input, OutputSink& output);
+        GameManager(AirshipOrderList& airshipOrderList, OutputSink& output);
+        ~GameManager();
+        GameManager(const GameManager&) = delete;
+        GameManager& operator=(const GameManager&) = delete;
+
+        void start(const DisplayManager& displayManager, size_t iFirstCustomer = 0);
+        void resume(const DisplayManager& displayManager, const GameState& state);
+        void step(const std::string& szInput);
+        void endOfInput();
+        void runShift(const DisplayManager& displayManager, size_t iFirstCustomer = 0);
+        SceneTask<> playShift(LineChannel& input, const DisplayManager& displayManager, size_t iFirstCustomer = 0);
+        bool isFinished() const { return m_state.phase == GamePhase::Finished; }
+        const GameState& getState() const { return m_state; }
+        bool getIsGuessCorrect() { return m_state.bIsGuessCorrect; }
+        void setManifestLog(ManifestLog* pManifestLog) { m_pManifestLog = pManifestLog; }
+        SessionFootprint getFootprint() const;
+        void setTracer(TraceRecorder* pTracer, uint32_t iTrack = 0) { m_pTracer = pTracer; m_iTraceTrack = iTrack; }
+        void setFraudulentName(const std::string& szName) { m_fraudulentPackageName = szName; }
+        const std::string& getFraudulentName() const { return m_fraudulentPackageName; }
+        void setScenario(const ScenarioGenerator* pScenario);
 };
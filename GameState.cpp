@@ -0,0 +1,206 @@
+/*********************************************************************
+File name: GameState.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for GameState serialization.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Compact byte encoding of a game session's state.
+Notes:
+    Layout: version, phase, customer, action and flag bytes, then the
+    current prompt fields and the undo record. Integers and Credits
+    are copied in host byte order, so states move between processes,
+    not between machines.
+*********************************************************************/
+
+#include "GameState.hpp"
+#include "SessionFootprint.hpp"
+#include <cstring>
+
+namespace
+{
+    const uint8_t STATE_VERSION = 3;       // 3: costs are Credits
+
+    /*********************************************************************
+    void putBytes(std::string& szOut, const void* pData, size_t iLength)
+    Purpose:
+        Appends raw bytes.
+    *********************************************************************/
+    void putBytes(std::string& szOut, const void* pData, size_t iLength)
+    {
+        szOut.append(static_cast<const char*>(pData), iLength);
+    }
+
+    /*********************************************************************
+    void putString(std::string& szOut, const std::string& szValue)
+    Purpose:
+        Appends a 32-bit length followed by the characters.
+    *********************************************************************/
+    void putString(std::string& szOut, const std::string& szValue)
+    {
+        uint32_t iLength = static_cast<uint32_t>(szValue.size());
+        putBytes(szOut, &iLength, sizeof(iLength));
+        szOut += szValue;
+    }
+
+    /*********************************************************************
+    bool getBytes(const std::string& szData, size_t& iPos, void* pOut, size_t iLength)
+    Purpose:
+        Copies the next iLength bytes out, failing at end of data.
+    *********************************************************************/
+    bool getBytes(const std::string& szData, size_t& iPos, void* pOut, size_t iLength)
+    {
+        if(iLength > szData.size() - iPos) return false;
+        std::memcpy(pOut, szData.data() + iPos, iLength);
+        iPos += iLength;
+        return true;
+    }
+
+    /*********************************************************************
+    bool getString(const std::string& szData, size_t& iPos, std::string& szValue)
+    Purpose:
+        Reads a string written by putString().
+    *********************************************************************/
+    bool getString(const std::string& szData, size_t& iPos, std::string& szValue)
+    {
+        uint32_t iLength = 0;
+        if(!getBytes(szData, iPos, &iLength, sizeof(iLength)) || iLength > szData.size() - iPos) return false;
+        szValue.assign(szData, iPos, iLength);
+        iPos += iLength;
+        return true;
+    }
+}
+
+/*********************************************************************
+void GameState::serialize(std::string& szOut) const
+Purpose:
+    Appends the encoded state to szOut.
+Parameters:
+    O std::string& szOut - Buffer the state is appended to
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void GameState::serialize(std::string& szOut) const
+{
+    uint8_t iFlags = (bHasRemovedPackage ? 1 : 0) | (bIsGuessCorrect ? 2 : 0) | (bHasUndo ? 4 : 0) |
+                     (bInputEnded ? 8 : 0);
+    uint8_t header[] = { STATE_VERSION, static_cast<uint8_t>(phase), iAction, iFlags };
+    putBytes(szOut, header, sizeof(header));
+    putBytes(szOut, &iCustomer, sizeof(iCustomer));
+
+    putString(szOut, szName);
+    putString(szOut, szItem);
+    putBytes(szOut, &iQuantity, sizeof(iQuantity));
+    putBytes(szOut, &cost, sizeof(cost));
+
+    if(bHasUndo)
+    {
+        putString(szOut, undoRecord.szName);
+        putString(szOut, undoRecord.szItem);
+        putBytes(szOut, &undoRecord.iQuantity, sizeof(undoRecord.iQuantity));
+        putBytes(szOut, &undoRecord.cost, sizeof(undoRecord.cost));
+    }
+}
+
+/*********************************************************************
+bool GameState::deserialize(const std::string& szData, GameState& state)
+Purpose:
+    Decodes a state written by serialize().
+Parameters:
+    I const std::string& szData - Encoded state
+    O GameState& state - Decoded state
+Return Value:
+    bool - False if szData is truncated or not a state
+Notes:
+    state is left partly written on failure.
+*********************************************************************/
+bool GameState::deserialize(const std::string& szData, GameState& state)
+{
+    size_t iPos = 0;
+    uint8_t header[4];
+    if(!getBytes(szData, iPos, header, sizeof(header)) || !getBytes(szData, iPos, &state.iCustomer, sizeof(state.iCustomer))) return false;
+    if(header[0] != STATE_VERSION || header[1] > static_cast<uint8_t>(GamePhase::SearchQuery)) return false;
+
+    state.phase = static_cast<GamePhase>(header[1]);
+    state.iAction = header[2];
+    state.bHasRemovedPackage = (header[3] & 1) != 0;
+    state.bIsGuessCorrect = (header[3] & 2) != 0;
+    state.bHasUndo = (header[3] & 4) != 0;
+    state.bInputEnded = (header[3] & 8) != 0;
+
+    if(!getString(szData, iPos, state.szName) || !getString(szData, iPos, state.szItem) ||
+       !getBytes(szData, iPos, &state.iQuantity, sizeof(state.iQuantity)) ||
+       !getBytes(szData, iPos, &state.cost, sizeof(state.cost)))
+    {
+        return false;
+    }
+
+    state.undoRecord = DeliveryRecord();
+    if(state.bHasUndo)
+    {
+        if(!getString(szData, iPos, state.undoRecord.szName) || !getString(szData, iPos, state.undoRecord.szItem) ||
+           !getBytes(szData, iPos, &state.undoRecord.iQuantity, sizeof(state.undoRecord.iQuantity)) ||
+           !getBytes(szData, iPos, &state.undoRecord.cost, sizeof(state.undoRecord.cost)))
+        {
+            return false;
+        }
+    }
+    return iPos == szData.size();
+}
+
+/*********************************************************************
+size_t GameState::heapBytes() const
+Purpose:
+    Heap memory held by the state's strings.
+Parameters:
+    None
+Return Value:
+    size_t - Bytes allocated for names and items too long to fit inline
+Notes:
+    None
+*********************************************************************/
+size_t GameState::heapBytes() const
+{
+    return SessionFootprint::heapBytes(szName) + SessionFootprint::heapBytes(szItem) +
+           SessionFootprint::heapBytes(undoRecord.szName) + SessionFootprint::heapBytes(undoRecord.szItem);
+}
+
+/*********************************************************************
+const char* gamePhaseName(GamePhase phase)
+Purpose:
+    Short name of a phase for traces and logs.
+Parameters:
+    I GamePhase phase - Phase to name
+Return Value:
+    const char* - Name matching the enumerator
+Notes:
+    None
+*********************************************************************/
+const char* gamePhaseName(GamePhase phase)
+{
+    switch(phase)
+    {
+        case GamePhase::ContinueToCustomer: return "ContinueToCustomer";
+        case GamePhase::CargoName: return "CargoName";
+        case GamePhase::CargoItem: return "CargoItem";
+        case GamePhase::CargoQuantity: return "CargoQuantity";
+        case GamePhase::CargoCost: return "CargoCost";
+        case GamePhase::GuessChoice: return "GuessChoice";
+        case GamePhase::GuessName: return "GuessName";
+        case GamePhase::GuessItem: return "GuessItem";
+        case GamePhase::ModifyQuantity: return "ModifyQuantity";
+        case GamePhase::ModifyCost: return "ModifyCost";
+        case GamePhase::RemoveConfirm: return "RemoveConfirm";
+        case GamePhase::ContinueToGuess: return "ContinueToGuess";
+        case GamePhase::Finished: return "Finished";
+        case GamePhase::SearchQuery: return "SearchQuery";
+    }
+    return "Unknown";
+}
@@ -0,0 +1,78 @@
+/*********************************************************************
+File name: GameState.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for GameState, the complete position of one game
+    session between two player inputs.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Definitions for GamePhase and GameState.
+Notes:
+    The manifest itself lives in the session's AirshipOrderList.
+*********************************************************************/
+
+#pragma once
+#include "Delivery.hpp"
+#include <cstdint>
+#include <string>
+
+/*********************************************************************
+Enum Name: GamePhase
+Purpose:
+    The prompt a session is waiting on.
+Notes:
+    Values are stored in serialized states, so only append.
+*********************************************************************/
+enum class GamePhase : uint8_t
+{
+    ContinueToCustomer = 0,   // "Press enter" before the next customer
+    CargoName = 1,            // Customer / sender name
+    CargoItem = 2,            // Item description
+    CargoQuantity = 3,        // Units
+    CargoCost = 4,            // Declared value
+    GuessChoice = 5,          // Guessing menu choice
+    GuessName = 6,            // Delivery name for find, modify or delete
+    GuessItem = 7,            // Item name for find, modify or delete
+    ModifyQuantity = 8,       // New quantity
+    ModifyCost = 9,           // New cost
+    RemoveConfirm = 10,       // y/n before deleting
+    ContinueToGuess = 11,     // "Press enter" before the menu returns
+    Finished = 12,            // Ending scene shown
+    SearchQuery = 13          // Text to search the manifest for
+};
+
+const char* gamePhaseName(GamePhase phase);
+
+/*********************************************************************
+Struct Name: GameState
+Purpose:
+    Everything GameManager needs to carry on from where a session
+    stopped, apart from the manifest.
+Notes:
+    serialize() produces a few dozen bytes; deserialize() rejects
+    anything it did not write.
+*********************************************************************/
+struct GameState
+{
+    GamePhase phase = GamePhase::ContinueToCustomer;   // Prompt being waited on
+    uint8_t iAction = 0;                                // Menu choice being carried out
+    bool bHasRemovedPackage = false;                    // A package has been deleted
+    bool bIsGuessCorrect = false;                       // The deleted package was the fraud
+    bool bHasUndo = false;                              // undoRecord is valid
+    bool bInputEnded = false;                           // Player input has run out
+    uint32_t iCustomer = 0;                             // Next customer scene to show
+    std::string szName;                                 // Name entered for the current prompt
+    std::string szItem;                                 // Item entered for the current prompt
+    int iQuantity = 0;                                  // Quantity entered for the current prompt
+    Credits cost;                                       // Cost entered for the current prompt
+    DeliveryRecord undoRecord;                          // Delivery before the last modification
+
+    void serialize(std::string& szOut) const;
+    static bool deserialize(const std::string& szData, GameState& state);
+    size_t heapBytes() const;
+};
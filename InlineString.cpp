@@ -0,0 +1,160 @@
+/*********************************************************************
+File name: InlineString.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the InlineString class.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Small-buffer text storage for delivery names and items.
+Notes:
+    The heap pointer and length are copied in and out of the storage
+    bytes with memcpy so no member is ever read through the wrong type.
+*********************************************************************/
+
+#include "InlineString.hpp"
+#include <cstring>
+
+/*********************************************************************
+const char* InlineString::heapData() const
+Purpose:
+    Reads the heap pointer of spilled text.
+Parameters:
+    None
+Return Value:
+    const char* - First character
+Notes:
+    Only valid when isHeap() is true.
+*********************************************************************/
+const char* InlineString::heapData() const
+{
+    const char* pText;
+    std::memcpy(&pText, storage, sizeof(pText));
+    return pText;
+}
+
+/*********************************************************************
+size_t InlineString::heapSize() const
+Purpose:
+    Reads the length of spilled text.
+Parameters:
+    None
+Return Value:
+    size_t - Number of characters
+Notes:
+    Only valid when isHeap() is true.
+*********************************************************************/
+size_t InlineString::heapSize() const
+{
+    size_t iLength;
+    std::memcpy(&iLength, storage + sizeof(char*), sizeof(iLength));
+    return iLength;
+}
+
+/*********************************************************************
+void InlineString::release()
+Purpose:
+    Frees spilled text and leaves the string empty and inline.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void InlineString::release()
+{
+    if(isHeap()) delete[] heapData();
+    storage[STORAGE_BYTES - 1] = 0;
+}
+
+/*********************************************************************
+void InlineString::assign(std::string_view szText)
+Purpose:
+    Replaces the text.
+Parameters:
+    I std::string_view szText - New text, which may not point into
+                                this string
+Return Value:
+    None
+Notes:
+    Text of INLINE_CHARS or fewer is stored in the object; longer text
+    gets one heap block of exactly its length.
+*********************************************************************/
+void InlineString::assign(std::string_view szText)
+{
+    release();
+    if(szText.size() <= INLINE_CHARS)
+    {
+        std::memcpy(storage, szText.data(), szText.size());
+        storage[STORAGE_BYTES - 1] = static_cast<char>(szText.size());
+        return;
+    }
+
+    char* pText = new char[szText.size()];
+    std::memcpy(pText, szText.data(), szText.size());
+    size_t iLength = szText.size();
+    std::memcpy(storage, &pText, sizeof(pText));
+    std::memcpy(storage + sizeof(char*), &iLength, sizeof(iLength));
+    storage[STORAGE_BYTES - 1] = static_cast<char>(HEAP_TAG);
+}
+
+/*********************************************************************
+InlineString::InlineString(InlineString&& other)
+Purpose:
+    Takes over another string's text.
+Parameters:
+    I/O InlineString&& other - Left empty
+Return Value:
+    None (constructor)
+Notes:
+    Spilled text changes owner without being copied.
+*********************************************************************/
+InlineString::InlineString(InlineString&& other) noexcept
+{
+    std::memcpy(storage, other.storage, STORAGE_BYTES);
+    other.storage[STORAGE_BYTES - 1] = 0;
+}
+
+/*********************************************************************
+InlineString& InlineString::operator=(const InlineString& other)
+Purpose:
+    Copies another string's text.
+Parameters:
+    I const InlineString& other - String to copy
+Return Value:
+    InlineString& - This string
+Notes:
+    None
+*********************************************************************/
+InlineString& InlineString::operator=(const InlineString& other)
+{
+    if(this != &other) assign(other.view());
+    return *this;
+}
+
+/*********************************************************************
+InlineString& InlineString::operator=(InlineString&& other)
+Purpose:
+    Takes over another string's text.
+Parameters:
+    I/O InlineString&& other - Left empty
+Return Value:
+    InlineString& - This string
+Notes:
+    None
+*********************************************************************/
+InlineString& InlineString::operator=(InlineString&& other) noexcept
+{
+    if(this != &other)
+    {
+        release();
+        std::memcpy(storage, other.storage, STORAGE_BYTES);
+        other.storage[STORAGE_BYTES - 1] = 0;
+    }
+    return *this;
+}
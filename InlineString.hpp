@@ -0,0 +1,84 @@
+/*********************************************************************
+File name: InlineString.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the InlineString class, the text type used for
+    delivery names and items.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for InlineString.
+Notes:
+    Every name and item in a shift fits inline, so a normal manifest
+    holds no heap text at all.
+*********************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+/*********************************************************************
+Class Name: InlineString
+Purpose:
+    Immutable-length string that keeps up to 31 characters inside the
+    object and moves longer text to a single heap block.
+Notes:
+    The object is 32 bytes, the same as std::string, but std::string
+    only holds 15 characters inline. The last byte is the inline
+    length, or HEAP_TAG once the text has spilled; the heap pointer
+    and length then occupy the first 16 bytes. Text is not
+    null-terminated. No live string ever has UNUSED_TAG in that byte,
+    which lets DeliveryPool mark free slots.
+*********************************************************************/
+class InlineString
+{
+    private:
+        static const size_t STORAGE_BYTES = 32;                      // Size of the whole object
+        static const unsigned char HEAP_TAG = 0xFF;                  // Last byte once spilled
+
+        alignas(char*) char storage[STORAGE_BYTES];                  // Inline text or heap pointer and length
+
+        bool isHeap() const { return static_cast<unsigned char>(storage[STORAGE_BYTES - 1]) == HEAP_TAG; }
+        const char* heapData() const;
+        size_t heapSize() const;
+        void release();
+
+    public:
+        static const size_t INLINE_CHARS = STORAGE_BYTES - 1;        // Longest text kept inline
+        static const size_t TAG_OFFSET = STORAGE_BYTES - 1;          // Byte holding the length or HEAP_TAG
+        static const unsigned char UNUSED_TAG = 0xFE;                // Tag byte value no string ever has
+
+        InlineString() { storage[STORAGE_BYTES - 1] = 0; }
+        explicit InlineString(std::string_view szText) { storage[STORAGE_BYTES - 1] = 0; assign(szText); }
+        InlineString(const InlineString& other) : InlineString(other.view()) {}
+        InlineString(InlineString&& other) noexcept;
+        InlineString& operator=(const InlineString& other);
+        InlineString& operator=(InlineString&& other) noexcept;
+        ~InlineString() { release(); }
+
+        void assign(std::string_view szText);
+        const char* data() const { return isHeap() ? heapData() : storage; }
+        size_t size() const { return isHeap() ? heapSize() : static_cast<unsigned char>(storage[STORAGE_BYTES - 1]); }
+        bool empty() const { return size() == 0; }
+        std::string_view view() const { return std::string_view(data(), size()); }
+        operator std::string_view() const { return view(); }
+        size_t heapBytes() const { return isHeap() ? heapSize() : 0; }
+
+        bool operator==(std::string_view szOther) const { return view() == szOther; }
+        bool operator==(const InlineString& other) const { return view() == other.view(); }
+};
+
+/*********************************************************************
+std::ostream& operator<<(std::ostream& out, const InlineString& szText)
+Purpose:
+    Writes the text to a stream like a std::string.
+*********************************************************************/
+inline std::ostream& operator<<(std::ostream& out, const InlineString& szText)
+{
+    return out << szText.view();
+}
@@ -0,0 +1,242 @@
+/*********************************************************************
+File name: InputReader.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the InputReader class.
+Command Parameters:
+    N/A
+Input:
+    Lines of player input from a descriptor or script.
+Results:
+    Lines for GameManager prompts, and the numbers typed on them.
+Notes:
+    Lines may end in "\n" or "\r\n".
+*********************************************************************/
+
+#include "InputReader.hpp"
+#include "SessionRecorder.hpp"
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+namespace
+{
+    /*********************************************************************
+    bool isSpace(char c)
+    Purpose:
+        Whitespace test matching what operator>> skips.
+    *********************************************************************/
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+}
+
+/*********************************************************************
+InputReader::InputReader(int iFileDescriptor, size_t iBufferBytes)
+Purpose:
+    Constructor for a reader over a file descriptor.
+Parameters:
+    I int iFileDescriptor - Descriptor to read from (0 for stdin)
+    I size_t iBufferBytes - Size of each read
+Return Value:
+    None (constructor)
+Notes:
+    The descriptor is not closed by the reader.
+*********************************************************************/
+InputReader::InputReader(int iFileDescriptor, size_t iBufferBytes) : iFd(iFileDescriptor), buffer(iBufferBytes) {}
+
+/*********************************************************************
+InputReader::InputReader(const std::string& szScript)
+Purpose:
+    Constructor for a reader over an in-memory script.
+Parameters:
+    I const std::string& szScript - Entire input, one line per prompt
+Return Value:
+    None (constructor)
+Notes:
+    Used for replays and headless sessions.
+*********************************************************************/
+InputReader::InputReader(const std::string& szScript) :
+    iFd(-1), buffer(szScript.begin(), szScript.end()), iEnd(szScript.size()), bEof(true) {}
+
+/*********************************************************************
+bool InputReader::refill()
+Purpose:
+    Reads more bytes from the descriptor.
+Parameters:
+    None
+Return Value:
+    bool - False once the source is exhausted
+Notes:
+    Keeps any partial line and grows the buffer when a single line
+    does not fit.
+*********************************************************************/
+bool InputReader::refill()
+{
+    if(bEof) return false;
+    if(pTied != nullptr) pTied->flush();
+
+    if(iStart > 0)
+    {
+        std::memmove(buffer.data(), buffer.data() + iStart, iEnd - iStart);
+        iEnd -= iStart;
+        iStart = 0;
+    }
+    if(iEnd == buffer.size()) buffer.resize(buffer.size() * 2);
+
+    while(true)
+    {
+        ssize_t iRead = ::read(iFd, buffer.data() + iEnd, buffer.size() - iEnd);
+        if(iRead > 0)
+        {
+            if(pRecorder != nullptr) pRecorder->record(buffer.data() + iEnd, static_cast<size_t>(iRead));
+            iEnd += static_cast<size_t>(iRead);
+            return true;
+        }
+        if(iRead < 0 && errno == EINTR) continue;
+        bEof = true;
+        return false;
+    }
+}
+
+/*********************************************************************
+bool InputReader::readLine(std::string& szLine)
+Purpose:
+    Reads the next line, like std::getline.
+Parameters:
+    O std::string& szLine - Line without its line ending
+Return Value:
+    bool - False if the input ended before any character was read
+Notes:
+    A final line without a newline is still returned.
+*********************************************************************/
+bool InputReader::readLine(std::string& szLine)
+{
+    size_t iScanFrom = iStart;
+    while(true)
+    {
+        const char* pNewline = static_cast<const char*>(std::memchr(buffer.data() + iScanFrom, '\n', iEnd - iScanFrom));
+        if(pNewline != nullptr)
+        {
+            size_t iLineEnd = static_cast<size_t>(pNewline - buffer.data());
+            size_t iTrimmedEnd = (iLineEnd > iStart && buffer[iLineEnd - 1] == '\r') ? iLineEnd - 1 : iLineEnd;
+            szLine.assign(buffer.data() + iStart, iTrimmedEnd - iStart);
+            iStart = iLineEnd + 1;
+            return true;
+        }
+
+        size_t iScanned = iEnd - iStart;
+        if(!refill())
+        {
+            if(iStart == iEnd) return false;
+            szLine.assign(buffer.data() + iStart, iEnd - iStart);
+            iStart = iEnd;
+            return true;
+        }
+        iScanFrom = iStart + iScanned;
+    }
+}
+
+/*********************************************************************
+size_t InputReader::skipSpace(const std::string& szLine)
+Purpose:
+    Finds the first non-whitespace character of a line.
+Parameters:
+    I const std::string& szLine - Line to scan
+Return Value:
+    size_t - Index of that character, szLine.size() for a blank line
+Notes:
+    Callers wait past a blank line rather than treat it as an answer.
+*********************************************************************/
+size_t InputReader::skipSpace(const std::string& szLine)
+{
+    size_t iPos = 0;
+    while(iPos < szLine.size() && isSpace(szLine[iPos])) iPos++;
+    return iPos;
+}
+
+/*********************************************************************
+size_t InputReader::tokenLength(const std::string& szLine, size_t iStart)
+Purpose:
+    Measures the whitespace-delimited token starting at iStart.
+Parameters:
+    I const std::string& szLine - Line holding the token
+    I size_t iStart - First character of the token
+Return Value:
+    size_t - Number of characters in the token
+Notes:
+    None
+*********************************************************************/
+size_t InputReader::tokenLength(const std::string& szLine, size_t iStart)
+{
+    size_t iEndPos = iStart;
+    while(iEndPos < szLine.size() && !isSpace(szLine[iEndPos])) iEndPos++;
+    return iEndPos - iStart;
+}
+
+/*********************************************************************
+bool InputReader::parseInt(const std::string& szLine, int& iValue)
+Purpose:
+    Parses the first token of a line as an integer.
+Parameters:
+    I const std::string& szLine - Line to parse
+    O int& iValue - Parsed value, untouched if the token is not a number
+Return Value:
+    bool - True if the token started with a number
+Notes:
+    Accepts a leading '+' and ignores anything after the digits.
+*********************************************************************/
+bool InputReader::parseInt(const std::string& szLine, int& iValue)
+{
+    size_t iStartPos = skipSpace(szLine);
+    const char* pBegin = szLine.data() + iStartPos;
+    const char* pEnd = pBegin + tokenLength(szLine, iStartPos);
+    if(pBegin != pEnd && *pBegin == '+') pBegin++;
+    std::from_chars_result result = std::from_chars(pBegin, pEnd, iValue);
+    return result.ec == std::errc() && result.ptr != pBegin;
+}
+
+/*********************************************************************
+bool InputReader::parseCredits(const std::string& szLine, Credits& value)
+Purpose:
+    Parses the first token of a line as an amount of credits.
+Parameters:
+    I const std::string& szLine - Line to parse
+    O Credits& value - Parsed amount, untouched if the token is not one
+Return Value:
+    bool - True if the token started with an amount
+Notes:
+    Accepts a leading '+' and ignores anything after the amount, like
+    parseInt(). See Credits::parse() for the forms accepted.
+*********************************************************************/
+bool InputReader::parseCredits(const std::string& szLine, Credits& value)
+{
+    size_t iStartPos = skipSpace(szLine);
+    const char* pBegin = szLine.data() + iStartPos;
+    const char* pEnd = pBegin + tokenLength(szLine, iStartPos);
+    if(pBegin != pEnd && *pBegin == '+') pBegin++;
+    return Credits::parse(pBegin, pEnd, value) != pBegin;
+}
+
+/*********************************************************************
+InputReader& InputReader::standardInput()
+Purpose:
+    Shared reader over standard input.
+Parameters:
+    None
+Return Value:
+    InputReader& - Reader on descriptor 0, tied to std::cout
+Notes:
+    None
+*********************************************************************/
+InputReader& InputReader::standardInput()
+{
+    static InputReader reader(0);
+    reader.tie(&std::cout);
+    return reader;
+}
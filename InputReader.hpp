@@ -0,0 +1,71 @@
+/*********************************************************************
+File name: InputReader.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the InputReader class, a buffered line reader used
+    for every player prompt.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for InputReader.
+Notes:
+    Replaces std::cin so piped replay scripts are not slowed down by
+    iostream synchronization.
+*********************************************************************/
+
+#pragma once
+#include "Credits.hpp"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class SessionRecorder;
+
+/*********************************************************************
+Class Name: InputReader
+Purpose:
+    Reads lines from a file descriptor or an in-memory script and
+    parses numbers with std::from_chars.
+Notes:
+    The parsers skip leading spaces like operator>> does, then use the
+    first token on the line and ignore the rest of it, matching the
+    old cin >> / cin.ignore() pairs. The tied stream is flushed before
+    any blocking read so prompts appear before the player is asked to
+    type. An attached SessionRecorder sees every chunk read from the
+    descriptor.
+*********************************************************************/
+class InputReader
+{
+    private:
+        int iFd;                              // Source descriptor, -1 for in-memory input
+        std::vector<char> buffer;             // Bytes read but not yet consumed
+        size_t iStart = 0;                    // First unconsumed byte in buffer
+        size_t iEnd = 0;                      // One past the last valid byte in buffer
+        bool bEof = false;                    // Source is exhausted
+        std::ostream* pTied = nullptr;        // Flushed before each blocking read
+        SessionRecorder* pRecorder = nullptr; // Receives every chunk read from iFd
+
+        bool refill();
+
+    public:
+        explicit InputReader(int iFileDescriptor = 0, size_t iBufferBytes = 64 * 1024);
+        explicit InputReader(const std::string& szScript);
+        InputReader(const InputReader&) = delete;
+        InputReader& operator=(const InputReader&) = delete;
+
+        bool readLine(std::string& szLine);
+        bool eof() const { return bEof && iStart == iEnd; }
+        std::ostream* tie(std::ostream* pStream) { std::ostream* pOld = pTied; pTied = pStream; return pOld; }
+        void setRecorder(SessionRecorder* pSessionRecorder) { pRecorder = pSessionRecorder; }
+
+        static size_t skipSpace(const std::string& szLine);
+        static size_t tokenLength(const std::string& szLine, size_t iStart);
+        static bool parseInt(const std::string& szLine, int& iValue);
+        static bool parseCredits(const std::string& szLine, Credits& value);
+        static InputReader& standardInput();
+};
@@ -0,0 +1,328 @@
+/*********************************************************************
+File name: ListInstrumentation.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the ListInstrumentation class.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Operation statistics and their text and JSON dumps.
+Notes:
+    Built either way so the dump API is always there; without
+    AIRSHIP_INSTRUMENT nothing ever records into it.
+*********************************************************************/
+
+#include "ListInstrumentation.hpp"
+#include <bit>
+#include <iomanip>
+
+namespace
+{
+    thread_local ListInstrumentation::Scope* pActiveScope = nullptr;   // Innermost open scope on this thread
+
+    /*********************************************************************
+    size_t bucketFor(uint64_t iValue)
+    Purpose:
+        Histogram bucket holding iValue.
+    *********************************************************************/
+    size_t bucketFor(uint64_t iValue)
+    {
+        size_t iBucket = static_cast<size_t>(std::bit_width(iValue));
+        return iBucket < ListInstrumentation::BUCKETS ? iBucket : ListInstrumentation::BUCKETS - 1;
+    }
+
+    /*********************************************************************
+    uint64_t percentile(const std::atomic<uint64_t>* buckets, uint64_t iCalls, double dFraction)
+    Purpose:
+        Upper bound of the bucket holding the given fraction of calls.
+    *********************************************************************/
+    uint64_t percentile(const std::atomic<uint64_t>* buckets, uint64_t iCalls, double dFraction)
+    {
+        if(iCalls == 0) return 0;
+        uint64_t iTarget = static_cast<uint64_t>(dFraction * static_cast<double>(iCalls));
+        if(iTarget >= iCalls) iTarget = iCalls - 1;
+        uint64_t iSeen = 0;
+        for(size_t iBucket = 0; iBucket < ListInstrumentation::BUCKETS; iBucket++)
+        {
+            iSeen += buckets[iBucket].load(std::memory_order_relaxed);
+            if(iSeen > iTarget) return iBucket == 0 ? 0 : (uint64_t(1) << iBucket) - 1;
+        }
+        return (uint64_t(1) << (ListInstrumentation::BUCKETS - 1)) - 1;
+    }
+
+    /*********************************************************************
+    void writeBuckets(std::ostream& out, const std::atomic<uint64_t>* buckets)
+    Purpose:
+        Writes a histogram as a JSON array, dropping empty top buckets.
+    *********************************************************************/
+    void writeBuckets(std::ostream& out, const std::atomic<uint64_t>* buckets)
+    {
+        size_t iUsed = ListInstrumentation::BUCKETS;
+        while(iUsed > 0 && buckets[iUsed - 1].load(std::memory_order_relaxed) == 0) iUsed--;
+        out << "[";
+        for(size_t iBucket = 0; iBucket < iUsed; iBucket++)
+        {
+            out << (iBucket > 0 ? "," : "") << buckets[iBucket].load(std::memory_order_relaxed);
+        }
+        out << "]";
+    }
+}
+
+/*********************************************************************
+ListInstrumentation::Scope::Scope(ListOp listOp)
+Purpose:
+    Opens a measured operation on this thread.
+Parameters:
+    I ListOp listOp - Operation being run
+Return Value:
+    None (constructor)
+Notes:
+    Only the outermost scope reads the clock.
+*********************************************************************/
+ListInstrumentation::Scope::Scope(ListOp listOp) : op(listOp), pParent(pActiveScope)
+{
+    pActiveScope = this;
+    if(pParent == nullptr) start = std::chrono::steady_clock::now();
+}
+
+/*********************************************************************
+ListInstrumentation::Scope::~Scope()
+Purpose:
+    Closes the operation and records it.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    A nested scope hands its node count to the enclosing one instead
+    of recording a call of its own.
+*********************************************************************/
+ListInstrumentation::Scope::~Scope()
+{
+    pActiveScope = pParent;
+    if(pParent != nullptr)
+    {
+        pParent->iNodes += iNodes;
+        return;
+    }
+    uint64_t iNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now() - start).count());
+    ListInstrumentation::global().record(op, iNs, iNodes);
+}
+
+/*********************************************************************
+ListInstrumentation::ListInstrumentation()
+Purpose:
+    Constructor that zeroes every counter.
+Parameters:
+    None
+Return Value:
+    None (constructor)
+Notes:
+    Only global() creates one.
+*********************************************************************/
+ListInstrumentation::ListInstrumentation()
+{
+    reset();
+}
+
+/*********************************************************************
+void ListInstrumentation::record(ListOp op, uint64_t iNs, uint64_t iNodes)
+Purpose:
+    Adds one completed call to the statistics.
+Parameters:
+    I ListOp op - Operation
+    I uint64_t iNs - Duration in nanoseconds
+    I uint64_t iNodes - Nodes visited
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void ListInstrumentation::record(ListOp op, uint64_t iNs, uint64_t iNodes)
+{
+    OpStats& stats = ops[static_cast<size_t>(op)];
+    stats.iCalls.fetch_add(1, std::memory_order_relaxed);
+    stats.iTotalNs.fetch_add(iNs, std::memory_order_relaxed);
+    stats.iTotalNodes.fetch_add(iNodes, std::memory_order_relaxed);
+    uint64_t iMax = stats.iMaxNodes.load(std::memory_order_relaxed);
+    while(iNodes > iMax && !stats.iMaxNodes.compare_exchange_weak(iMax, iNodes, std::memory_order_relaxed)) {}
+    stats.latencyBuckets[bucketFor(iNs)].fetch_add(1, std::memory_order_relaxed);
+    stats.nodeBuckets[bucketFor(iNodes)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/*********************************************************************
+void ListInstrumentation::reset()
+Purpose:
+    Zeroes every counter.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Calls still in progress are recorded after the reset.
+*********************************************************************/
+void ListInstrumentation::reset()
+{
+    for(OpStats& stats : ops)
+    {
+        stats.iCalls = 0;
+        stats.iTotalNs = 0;
+        stats.iTotalNodes = 0;
+        stats.iMaxNodes = 0;
+        for(size_t iBucket = 0; iBucket < BUCKETS; iBucket++)
+        {
+            stats.latencyBuckets[iBucket] = 0;
+            stats.nodeBuckets[iBucket] = 0;
+        }
+    }
+    iBytesAllocated = 0;
+}
+
+/*********************************************************************
+void ListInstrumentation::writeText(std::ostream& out) const
+Purpose:
+    Writes a table with one row per operation that was called.
+Parameters:
+    I/O std::ostream& out - Destination
+Return Value:
+    None
+Notes:
+    Percentiles are bucket upper bounds, so within a factor of two.
+*********************************************************************/
+void ListInstrumentation::writeText(std::ostream& out) const
+{
+    if(!isEnabled())
+    {
+        out << "list instrumentation compiled out (build with make INSTRUMENT=1)\n";
+        return;
+    }
+
+    out << "list instrumentation, " << iBytesAllocated.load(std::memory_order_relaxed) << " bytes allocated\n";
+    out << std::left << std::setw(13) << "operation" << std::right << std::setw(12) << "calls" << std::setw(12) << "total ms"
+        << std::setw(12) << "avg ns" << std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns"
+        << std::setw(11) << "avg nodes" << std::setw(11) << "max nodes" << "\n";
+    for(size_t iOp = 0; iOp < static_cast<size_t>(ListOp::Count); iOp++)
+    {
+        const OpStats& stats = ops[iOp];
+        uint64_t iCalls = stats.iCalls.load(std::memory_order_relaxed);
+        if(iCalls == 0) continue;
+        uint64_t iTotalNs = stats.iTotalNs.load(std::memory_order_relaxed);
+        out << std::left << std::setw(13) << opName(static_cast<ListOp>(iOp)) << std::right << std::setw(12) << iCalls
+            << std::setw(12) << std::fixed << std::setprecision(2) << iTotalNs / 1e6 << std::defaultfloat
+            << std::setw(12) << iTotalNs / iCalls
+            << std::setw(12) << percentile(stats.latencyBuckets, iCalls, 0.50)
+            << std::setw(12) << percentile(stats.latencyBuckets, iCalls, 0.99)
+            << std::setw(11) << stats.iTotalNodes.load(std::memory_order_relaxed) / iCalls
+            << std::setw(11) << stats.iMaxNodes.load(std::memory_order_relaxed) << "\n";
+    }
+}
+
+/*********************************************************************
+void ListInstrumentation::writeJson(std::ostream& out) const
+Purpose:
+    Writes every statistic as one JSON object.
+Parameters:
+    I/O std::ostream& out - Destination
+Return Value:
+    None
+Notes:
+    Operations that were never called are left out. Histogram arrays
+    are indexed by bucket: entry b counts calls below 2^b.
+*********************************************************************/
+void ListInstrumentation::writeJson(std::ostream& out) const
+{
+    out << "{\"enabled\":" << (isEnabled() ? "true" : "false")
+        << ",\"bytesAllocated\":" << iBytesAllocated.load(std::memory_order_relaxed) << ",\"operations\":{";
+    bool bFirst = true;
+    for(size_t iOp = 0; iOp < static_cast<size_t>(ListOp::Count); iOp++)
+    {
+        const OpStats& stats = ops[iOp];
+        uint64_t iCalls = stats.iCalls.load(std::memory_order_relaxed);
+        if(iCalls == 0) continue;
+        out << (bFirst ? "" : ",") << "\"" << opName(static_cast<ListOp>(iOp)) << "\":{\"calls\":" << iCalls
+            << ",\"totalNs\":" << stats.iTotalNs.load(std::memory_order_relaxed)
+            << ",\"p50Ns\":" << percentile(stats.latencyBuckets, iCalls, 0.50)
+            << ",\"p99Ns\":" << percentile(stats.latencyBuckets, iCalls, 0.99)
+            << ",\"nodesTraversed\":" << stats.iTotalNodes.load(std::memory_order_relaxed)
+            << ",\"maxNodes\":" << stats.iMaxNodes.load(std::memory_order_relaxed) << ",\"latencyBuckets\":";
+        writeBuckets(out, stats.latencyBuckets);
+        out << ",\"nodeBuckets\":";
+        writeBuckets(out, stats.nodeBuckets);
+        out << "}";
+        bFirst = false;
+    }
+    out << "}}\n";
+}
+
+/*********************************************************************
+ListInstrumentation& ListInstrumentation::global()
+Purpose:
+    The statistics shared by every list in the process.
+Parameters:
+    None
+Return Value:
+    ListInstrumentation& - The shared instance
+Notes:
+    None
+*********************************************************************/
+ListInstrumentation& ListInstrumentation::global()
+{
+    static ListInstrumentation instrumentation;
+    return instrumentation;
+}
+
+/*********************************************************************
+bool ListInstrumentation::isEnabled()
+Purpose:
+    Reports whether this build records anything.
+Parameters:
+    None
+Return Value:
+    bool - True when built with AIRSHIP_INSTRUMENT
+Notes:
+    None
+*********************************************************************/
+bool ListInstrumentation::isEnabled()
+{
+#ifdef AIRSHIP_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*********************************************************************
+const char* ListInstrumentation::opName(ListOp op)
+Purpose:
+    Name of an operation in dumps.
+Parameters:
+    I ListOp op - Operation
+Return Value:
+    const char* - Name matching the AirshipOrderList method
+Notes:
+    None
+*********************************************************************/
+const char* ListInstrumentation::opName(ListOp op)
+{
+    switch(op)
+    {
+        case ListOp::Add: return "add";
+        case ListOp::Find: return "find";
+        case ListOp::Remove: return "remove";
+        case ListOp::Modify: return "modify";
+        case ListOp::Display: return "display";
+        case ListOp::AddBatch: return "addBatch";
+        case ListOp::RemoveBatch: return "removeBatch";
+        case ListOp::ModifyBatch: return "modifyBatch";
+        case ListOp::Clear: return "clear";
+        case ListOp::Validate: return "countInvalid";
+        case ListOp::Totals: return "totals";
+        case ListOp::Sort: return "sortBy";
+        default: return "unknown";
+    }
+}
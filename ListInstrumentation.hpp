@@ -0,0 +1,121 @@
+/*********************************************************************
+File name: ListInstrumentation.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the ListInstrumentation class, optional counters
+    and latency histograms for AirshipOrderList operations.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for ListInstrumentation and the INSTRUMENT_*
+    macros used by AirshipOrderList and DeliveryPool.
+Notes:
+    Compiled in only when AIRSHIP_INSTRUMENT is defined ("make
+    INSTRUMENT=1" after "make clean"). Otherwise every macro expands
+    to nothing and the list code is exactly what it was without it.
+*********************************************************************/
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/*********************************************************************
+Enum Name: ListOp
+Purpose:
+    AirshipOrderList operations that are counted separately.
+*********************************************************************/
+enum class ListOp : uint8_t
+{
+    Add, Find, Remove, Modify, Display, AddBatch, RemoveBatch, ModifyBatch, Clear, Validate, Totals, Sort,
+    Count
+};
+
+/*********************************************************************
+Class Name: ListInstrumentation
+Purpose:
+    Process-wide counts, nodes traversed, latency histograms and bytes
+    allocated for every AirshipOrderList.
+Notes:
+    Counters are relaxed atomics so lists read under a shared lock can
+    be measured too. Histograms use power-of-two buckets: bucket b
+    holds values below 2^b. Operations nested inside another, such as
+    the adds inside addDeliveries(), are folded into the outer one so
+    each public call is counted once.
+*********************************************************************/
+class ListInstrumentation
+{
+    public:
+        static const size_t BUCKETS = 40;                      // Histogram buckets, up to 2^39
+
+        /*********************************************************************
+        Class Name: Scope
+        Purpose:
+            Times one operation and counts the nodes it visits.
+        *********************************************************************/
+        class Scope
+        {
+            private:
+                ListOp op;                                     // Operation being measured
+                uint64_t iNodes = 0;                           // Nodes visited so far
+                Scope* pParent;                                // Enclosing scope on this thread
+                std::chrono::steady_clock::time_point start;   // When the outermost scope began
+
+            public:
+                explicit Scope(ListOp listOp);
+                ~Scope();
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+                void addNode() { iNodes++; }
+                void addNodes(uint64_t iCount) { iNodes += iCount; }
+        };
+
+    private:
+        struct OpStats
+        {
+            std::atomic<uint64_t> iCalls{0};                   // Completed calls
+            std::atomic<uint64_t> iTotalNs{0};                 // Time spent in them
+            std::atomic<uint64_t> iTotalNodes{0};              // Nodes visited by them
+            std::atomic<uint64_t> iMaxNodes{0};                // Most nodes visited by one call
+            std::atomic<uint64_t> latencyBuckets[BUCKETS];     // Calls by duration in nanoseconds
+            std::atomic<uint64_t> nodeBuckets[BUCKETS];        // Calls by nodes visited
+        };
+
+        OpStats ops[static_cast<size_t>(ListOp::Count)];       // Stats by operation
+        std::atomic<uint64_t> iBytesAllocated{0};              // Pool chunks and spilled delivery text
+
+        ListInstrumentation();
+        void record(ListOp op, uint64_t iNs, uint64_t iNodes);
+
+    public:
+        ListInstrumentation(const ListInstrumentation&) = delete;
+        ListInstrumentation& operator=(const ListInstrumentation&) = delete;
+
+        void addBytes(size_t iBytes) { iBytesAllocated.fetch_add(iBytes, std::memory_order_relaxed); }
+        void reset();
+        void writeText(std::ostream& out) const;
+        void writeJson(std::ostream& out) const;
+
+        static ListInstrumentation& global();
+        static bool isEnabled();
+        static const char* opName(ListOp op);
+};
+
+#ifdef AIRSHIP_INSTRUMENT
+#define INSTRUMENT_SCOPE(op) ListInstrumentation::Scope listScope(op)
+#define INSTRUMENT_NODE() listScope.addNode()
+#define INSTRUMENT_NODES(count) listScope.addNodes(count)
+#define INSTRUMENT_BYTES(bytes) ListInstrumentation::global().addBytes(bytes)
+#else
+#define INSTRUMENT_SCOPE(op) ((void)0)
+#define INSTRUMENT_NODE() ((void)0)
+#define INSTRUMENT_NODES(count) ((void)(count))
+#define INSTRUMENT_BYTES(bytes) ((void)0)
+#endif
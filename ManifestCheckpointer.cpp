@@ -0,0 +1,181 @@
+/*********************************************************************
+File name: ManifestCheckpointer.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the ManifestCheckpointer class.
+Command Parameters:
+    N/A
+Input:
+    Sealed manifest log segments and the previous checkpoint.
+Results:
+    A new checkpoint, with the folded segments deleted.
+Notes:
+    A crash at any point leaves a recoverable state: segments are
+    only deleted after the checkpoint covering them is durable, and
+    replay skips records the checkpoint already holds.
+*********************************************************************/
+
+#include "ManifestCheckpointer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/*********************************************************************
+ManifestCheckpointer::ManifestCheckpointer(ManifestLog& log, const string& szCheckpoint, int iIntervalMilliseconds)
+Purpose:
+    Starts the background checkpoint thread.
+Parameters:
+    I/O ManifestLog& log - Log to compact
+    I const string& szCheckpoint - Checkpoint file path
+    I int iIntervalMilliseconds - Time between passes; 0 disables the
+      thread so only checkpointNow() runs passes
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+ManifestCheckpointer::ManifestCheckpointer(ManifestLog& log, const string& szCheckpoint, int iIntervalMilliseconds) :
+    manifestLog(log), szCheckpointPath(szCheckpoint), iIntervalMs(iIntervalMilliseconds)
+{
+    if(iIntervalMs > 0)
+    {
+        checkpointThread = std::thread(&ManifestCheckpointer::runCheckpointThread, this);
+    }
+}
+
+/*********************************************************************
+ManifestCheckpointer::~ManifestCheckpointer()
+Purpose:
+    Destructor that stops the background thread.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    A pass already running is allowed to finish.
+*********************************************************************/
+ManifestCheckpointer::~ManifestCheckpointer()
+{
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        bStopping = true;
+    }
+    stopRequested.notify_all();
+    if(checkpointThread.joinable()) checkpointThread.join();
+}
+
+/*********************************************************************
+void ManifestCheckpointer::runCheckpointThread()
+Purpose:
+    Runs a checkpoint pass every iIntervalMs until stopped.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void ManifestCheckpointer::runCheckpointThread()
+{
+    std::unique_lock<std::mutex> lock(stopMutex);
+    while(!bStopping)
+    {
+        stopRequested.wait_for(lock, std::chrono::milliseconds(iIntervalMs));
+        if(bStopping) break;
+
+        lock.unlock();
+        checkpointNow();
+        lock.lock();
+    }
+}
+
+/*********************************************************************
+bool ManifestCheckpointer::checkpointNow()
+Purpose:
+    Runs one checkpoint pass immediately.
+Parameters:
+    None
+Return Value:
+    bool - True if a new checkpoint was written
+Notes:
+    Returns false when nothing was logged since the last pass.
+    Segments left by a failed earlier pass are folded in as well.
+*********************************************************************/
+bool ManifestCheckpointer::checkpointNow()
+{
+    std::lock_guard<std::mutex> lock(checkpointMutex);
+    manifestLog.rotate();
+
+    vector<string> segments = ManifestLog::sealedSegments(manifestLog.getPath());
+    if(segments.empty()) return false;
+
+    AirshipOrderList image;
+    uint64_t iLsn = 0;
+    ManifestLog::replay(szCheckpointPath, image, 0, &iLsn);
+    for(const string& szSegment : segments)
+    {
+        ManifestLog::replay(szSegment, image, iLsn, &iLsn);
+    }
+
+    if(!ManifestLog::writeCheckpoint(szCheckpointPath, image, iLsn)) return false;
+    for(const string& szSegment : segments)
+    {
+        std::remove(szSegment.c_str());
+    }
+    return true;
+}
+
+/*********************************************************************
+void ManifestCheckpointer::discard()
+Purpose:
+    Deletes the checkpoint and every log record, e.g. at shift end.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void ManifestCheckpointer::discard()
+{
+    std::lock_guard<std::mutex> lock(checkpointMutex);
+    manifestLog.discard();
+    for(const string& szSegment : ManifestLog::sealedSegments(manifestLog.getPath()))
+    {
+        std::remove(szSegment.c_str());
+    }
+    std::remove(szCheckpointPath.c_str());
+}
+
+/*********************************************************************
+size_t ManifestCheckpointer::recover(const string& szLogPath, const string& szCheckpoint, AirshipOrderList& orderList, uint64_t* pLastLsn)
+Purpose:
+    Rebuilds a manifest from the newest checkpoint and the log tail.
+Parameters:
+    I const string& szLogPath - Active log path
+    I const string& szCheckpoint - Checkpoint file path
+    I/O AirshipOrderList& orderList - Empty list to rebuild into
+    O uint64_t* pLastLsn - Optional; receives the newest sequence number
+Return Value:
+    size_t - Number of log records replayed after the checkpoint
+Notes:
+    Pass the sequence number to ManifestLog::advanceLsn before logging
+    anything new.
+*********************************************************************/
+size_t ManifestCheckpointer::recover(const string& szLogPath, const string& szCheckpoint, AirshipOrderList& orderList, uint64_t* pLastLsn)
+{
+    uint64_t iLsn = 0;
+    ManifestLog::replay(szCheckpoint, orderList, 0, &iLsn);
+
+    size_t iReplayed = 0;
+    for(const string& szSegment : ManifestLog::sealedSegments(szLogPath))
+    {
+        iReplayed += ManifestLog::replay(szSegment, orderList, iLsn, &iLsn);
+    }
+    iReplayed += ManifestLog::replay(szLogPath, orderList, iLsn, &iLsn);
+
+    if(pLastLsn != nullptr) *pLastLsn = iLsn;
+    return iReplayed;
+}
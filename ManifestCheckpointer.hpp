@@ -0,0 +1,65 @@
+/*********************************************************************
+File name: ManifestCheckpointer.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the ManifestCheckpointer class, which periodically
+    compacts the manifest write-ahead log into a checkpoint.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for ManifestCheckpointer.
+Notes:
+    Keeps restart time bounded by manifest size, not shift length.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include "ManifestLog.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*********************************************************************
+Class Name: ManifestCheckpointer
+Purpose:
+    Background thread that folds sealed log segments into a compact
+    checkpoint file and deletes them.
+Notes:
+    Each pass rotates the log, rebuilds a private list from the old
+    checkpoint plus the sealed segments, writes it out atomically and
+    removes the segments. The live AirshipOrderList is never read, so
+    addDelivery calls are not paused; appenders only wait for the
+    rename inside rotate(). recover() loads the newest checkpoint and
+    replays just the segments and active log written after it.
+*********************************************************************/
+class ManifestCheckpointer
+{
+    private:
+        ManifestLog& manifestLog;              // Log being compacted
+        string szCheckpointPath;               // Checkpoint file path
+        int iIntervalMs;                       // Time between passes
+        std::mutex checkpointMutex;            // One pass at a time
+        std::mutex stopMutex;                  // Guards bStopping
+        std::condition_variable stopRequested; // Wakes the thread for shutdown
+        bool bStopping = false;                // Tells the thread to exit
+        std::thread checkpointThread;          // Background pass loop
+
+        void runCheckpointThread();
+
+    public:
+        ManifestCheckpointer(ManifestLog& log, const string& szCheckpoint, int iIntervalMilliseconds);
+        ~ManifestCheckpointer();
+        ManifestCheckpointer(const ManifestCheckpointer&) = delete;
+        ManifestCheckpointer& operator=(const ManifestCheckpointer&) = delete;
+
+        bool checkpointNow();
+        void discard();
+
+        static size_t recover(const string& szLogPath, const string& szCheckpoint, AirshipOrderList& orderList, uint64_t* pLastLsn = nullptr);
+};
@@ -0,0 +1,751 @@
+/*********************************************************************
+File name: ManifestLog.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the ManifestLog class.
+Command Parameters:
+    N/A
+Input:
+    Manifest mutations, or an existing log file to replay.
+Results:
+    Durable, replayable record of every manifest change.
+Notes:
+    Record layout: u32 payload length, u32 checksum, then a payload
+    of u8 type, u64 lsn, u32 name length, name, u32 item length, item,
+    i32 quantity, i64 cost in cents. Integers are in host byte order.
+    The type's CENTS_FLAG bit marks that cost layout; records written
+    without it carry an f64 cost, which replays rounded to the cent.
+*********************************************************************/
+
+#include "ManifestLog.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <unistd.h>
+#include <utility>
+
+namespace
+{
+    const size_t RECORD_HEADER_BYTES = 2 * sizeof(uint32_t);
+    const uint8_t CENTS_FLAG = 0x80;   // Type bit of records whose cost is whole cents; older ones hold a double
+
+    /*********************************************************************
+    uint32_t checksum(const char* pData, size_t iLength)
+    Purpose:
+        FNV-1a hash used to detect torn or corrupt records.
+    *********************************************************************/
+    uint32_t checksum(const char* pData, size_t iLength)
+    {
+        uint32_t iHash = 2166136261u;
+        for(size_t i = 0; i < iLength; i++)
+        {
+            iHash ^= static_cast<unsigned char>(pData[i]);
+            iHash *= 16777619u;
+        }
+        return iHash;
+    }
+
+    template <typename T>
+    void putValue(std::string& szOut, T value)
+    {
+        szOut.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool getValue(const char*& pCursor, const char* pEnd, T& value)
+    {
+        if(static_cast<size_t>(pEnd - pCursor) < sizeof(T)) return false;
+        std::memcpy(&value, pCursor, sizeof(T));
+        pCursor += sizeof(T);
+        return true;
+    }
+
+    bool getString(const char*& pCursor, const char* pEnd, std::string& szValue)
+    {
+        uint32_t iLength;
+        if(!getValue(pCursor, pEnd, iLength) || static_cast<size_t>(pEnd - pCursor) < iLength) return false;
+        szValue.assign(pCursor, iLength);
+        pCursor += iLength;
+        return true;
+    }
+
+    /*********************************************************************
+    void encodeRecord(std::string& szOut, ManifestLog::RecordType type, uint64_t iLsn, std::string_view szName, std::string_view szItem, int iQuantity, Credits cost)
+    Purpose:
+        Appends one framed, checksummed record to szOut.
+    *********************************************************************/
+    void encodeRecord(std::string& szOut, ManifestLog::RecordType type, uint64_t iLsn, std::string_view szName,
+                      std::string_view szItem, int iQuantity, Credits cost)
+    {
+        size_t iRecordStart = szOut.size();
+        putValue<uint32_t>(szOut, 0);
+        putValue<uint32_t>(szOut, 0);
+        putValue<uint8_t>(szOut, static_cast<uint8_t>(type | CENTS_FLAG));
+        putValue<uint64_t>(szOut, iLsn);
+        putValue<uint32_t>(szOut, static_cast<uint32_t>(szName.size()));
+        szOut.append(szName);
+        putValue<uint32_t>(szOut, static_cast<uint32_t>(szItem.size()));
+        szOut.append(szItem);
+        putValue<int32_t>(szOut, iQuantity);
+        putValue<int64_t>(szOut, cost.cents());
+
+        const char* pPayload = szOut.data() + iRecordStart + RECORD_HEADER_BYTES;
+        uint32_t iLength = static_cast<uint32_t>(szOut.size() - iRecordStart - RECORD_HEADER_BYTES);
+        uint32_t iChecksum = checksum(pPayload, iLength);
+        std::memcpy(&szOut[iRecordStart], &iLength, sizeof(iLength));
+        std::memcpy(&szOut[iRecordStart + sizeof(iLength)], &iChecksum, sizeof(iChecksum));
+    }
+
+    /*********************************************************************
+    bool writeAll(int iFd, const std::string& szData)
+    Purpose:
+        Writes the whole buffer, retrying short and interrupted writes.
+    *********************************************************************/
+    bool writeAll(int iFd, const std::string& szData)
+    {
+        const char* pData = szData.data();
+        size_t iLeft = szData.size();
+        while(iLeft > 0)
+        {
+            ssize_t iWritten = ::write(iFd, pData, iLeft);
+            if(iWritten < 0 && errno == EINTR) continue;
+            if(iWritten < 0) return false;
+            pData += iWritten;
+            iLeft -= static_cast<size_t>(iWritten);
+        }
+        return true;
+    }
+
+    /*********************************************************************
+    template <typename Visitor> size_t forEachRecord(const std::string& szLog, Visitor visit)
+    Purpose:
+        Decodes records in order until the end or the first bad record.
+    Return Value:
+        Number of bytes holding valid records.
+    *********************************************************************/
+    template <typename Visitor>
+    size_t forEachRecord(const std::string& szLog, Visitor visit)
+    {
+        const char* pStart = szLog.data();
+        const char* pEnd = pStart + szLog.size();
+        const char* pCursor = pStart;
+        std::string szName;
+        std::string szItem;
+
+        while(static_cast<size_t>(pEnd - pCursor) >= RECORD_HEADER_BYTES)
+        {
+            const char* pRecord = pCursor;
+            uint32_t iLength = 0;
+            uint32_t iChecksum = 0;
+            getValue(pCursor, pEnd, iLength);
+            getValue(pCursor, pEnd, iChecksum);
+            if(static_cast<size_t>(pEnd - pCursor) < iLength || checksum(pCursor, iLength) != iChecksum)
+            {
+                return static_cast<size_t>(pRecord - pStart);
+            }
+
+            const char* pPayloadEnd = pCursor + iLength;
+            uint8_t iType;
+            uint64_t iLsn;
+            int32_t iQuantity;
+            if(!getValue(pCursor, pPayloadEnd, iType) || !getValue(pCursor, pPayloadEnd, iLsn) ||
+               !getString(pCursor, pPayloadEnd, szName) || !getString(pCursor, pPayloadEnd, szItem) ||
+               !getValue(pCursor, pPayloadEnd, iQuantity))
+            {
+                return static_cast<size_t>(pRecord - pStart);
+            }
+
+            Credits cost;
+            if(iType & CENTS_FLAG)
+            {
+                int64_t iCents;
+                if(!getValue(pCursor, pPayloadEnd, iCents)) return static_cast<size_t>(pRecord - pStart);
+                cost = Credits::fromCents(iCents);
+            }
+            else
+            {
+                double dCost;
+                if(!getValue(pCursor, pPayloadEnd, dCost)) return static_cast<size_t>(pRecord - pStart);
+                cost = Credits::fromDouble(dCost);
+            }
+            visit(static_cast<ManifestLog::RecordType>(iType & ~CENTS_FLAG), iLsn, szName, szItem, iQuantity, cost);
+            pCursor = pPayloadEnd;
+        }
+        return static_cast<size_t>(pCursor - pStart);
+    }
+
+    /*********************************************************************
+    std::string readFile(const std::string& szPath)
+    Purpose:
+        Reads a whole file, returning an empty string if it is missing.
+    *********************************************************************/
+    std::string readFile(const std::string& szPath)
+    {
+        std::ifstream file(szPath, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+/*********************************************************************
+ManifestLog::ManifestLog(const string& szPath, const ManifestLogOptions& logOptions)
+Purpose:
+    Opens (or creates) a log for appending.
+Parameters:
+    I const string& szPath - Log file path
+    I const ManifestLogOptions& logOptions - Durability settings
+Return Value:
+    None (constructor)
+Notes:
+    Sequence numbers continue from the last record already in the
+    file, and any torn record at the end is cut off so new records
+    are not hidden behind it. Check isOpen() afterwards.
+*********************************************************************/
+ManifestLog::ManifestLog(const string& szPath, const ManifestLogOptions& logOptions) : szLogPath(szPath), options(logOptions)
+{
+    std::string szExisting = readFile(szPath);
+    size_t iValidBytes = forEachRecord(szExisting, [this](RecordType, uint64_t iLsn, const string&, const string&, int, Credits)
+    {
+        iLastLsn = iLsn;
+    });
+    iBufferedLsn = iLastLsn;
+    iDurableLsn = iLastLsn;
+    iFileBytes = static_cast<off_t>(iValidBytes);
+
+    iFd = ::open(szPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if(iFd < 0) return;
+    if(iValidBytes < szExisting.size() && ::ftruncate(iFd, static_cast<off_t>(iValidBytes)) != 0)
+    {
+        ::close(iFd);
+        iFd = -1;
+        return;
+    }
+
+    szBuffer.reserve(options.iBufferBytes);
+    if(options.syncMode == LogSyncMode::Periodic)
+    {
+        syncThread = std::thread(&ManifestLog::runSyncThread, this);
+    }
+}
+
+/*********************************************************************
+ManifestLog::~ManifestLog()
+Purpose:
+    Destructor that writes out and syncs any buffered records.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    Stops the periodic sync thread first.
+*********************************************************************/
+ManifestLog::~ManifestLog()
+{
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
+        bStopping = true;
+    }
+    stopRequested.notify_all();
+    if(syncThread.joinable()) syncThread.join();
+
+    if(iFd >= 0)
+    {
+        sync();
+        ::close(iFd);
+    }
+}
+
+/*********************************************************************
+bool ManifestLog::flushLocked(std::unique_lock<std::mutex>& lock, bool bSync)
+Purpose:
+    Writes every buffered record and optionally fsyncs.
+Parameters:
+    I/O std::unique_lock<std::mutex>& lock - Held on entry and exit
+    I bool bSync - Whether to fdatasync after writing
+Return Value:
+    bool - False if the log has failed, now or earlier
+Notes:
+    The lock is released during the write so other threads can keep
+    appending into the next batch. On failure the file is cut back to
+    its last whole record, so no torn record hides later ones, and the
+    batch goes back in front of the buffer. The failure is latched:
+    retrying an fsync that failed cannot tell what reached the disk.
+*********************************************************************/
+bool ManifestLog::flushLocked(std::unique_lock<std::mutex>& lock, bool bSync)
+{
+    while(bFlushing) flushDone.wait(lock);
+    if(bFailed) return false;
+
+    bFlushing = true;
+    szWriteBuffer.clear();
+    szWriteBuffer.swap(szBuffer);
+    uint64_t iBatchLsn = iLastLsn;
+    off_t iBatchStart = iFileBytes;
+    lock.unlock();
+
+    bool bOk = writeAll(iFd, szWriteBuffer);
+    if(bOk && bSync) bOk = (::fdatasync(iFd) == 0);
+    if(!bOk) ::ftruncate(iFd, iBatchStart);
+
+    lock.lock();
+    if(bOk)
+    {
+        iFileBytes = iBatchStart + static_cast<off_t>(szWriteBuffer.size());
+        iBufferedLsn = iBatchLsn;
+        if(bSync) iDurableLsn = iBatchLsn;
+    }
+    else
+    {
+        szWriteBuffer.append(szBuffer);
+        szBuffer.swap(szWriteBuffer);
+        bFailed = true;
+    }
+    bFlushing = false;
+    flushDone.notify_all();
+    return bOk;
+}
+
+/*********************************************************************
+void ManifestLog::runSyncThread()
+Purpose:
+    Periodic mode loop that fsyncs outstanding records.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Exits when the destructor sets bStopping.
+*********************************************************************/
+void ManifestLog::runSyncThread()
+{
+    std::unique_lock<std::mutex> lock(logMutex);
+    while(!bStopping)
+    {
+        stopRequested.wait_for(lock, std::chrono::milliseconds(options.iSyncIntervalMs));
+        if(!bStopping && iDurableLsn < iLastLsn) flushLocked(lock, true);
+    }
+}
+
+/*********************************************************************
+uint64_t ManifestLog::append(RecordType type, const string& szCust, const string& szItm, int iQty, Credits cost)
+Purpose:
+    Encodes one record and applies the durability setting.
+Parameters:
+    I RecordType type - Operation being logged
+    I const string& szCust - Customer name
+    I const string& szItm - Item name
+    I int iQty - Quantity (unused for removes)
+    I Credits cost - Cost (unused for removes)
+Return Value:
+    uint64_t - Sequence number of the record, or 0 if it could not be
+               logged
+Notes:
+    In GroupCommit mode does not return until the record is fsynced.
+    Once a write or fsync has failed every append returns 0.
+*********************************************************************/
+uint64_t ManifestLog::append(RecordType type, const string& szCust, const string& szItm, int iQty, Credits cost)
+{
+    std::unique_lock<std::mutex> lock(logMutex);
+    if(iFd < 0 || bFailed) return 0;
+    uint64_t iLsn = ++iLastLsn;
+    encodeRecord(szBuffer, type, iLsn, szCust, szItm, iQty, cost);
+
+    if(options.syncMode == LogSyncMode::GroupCommit)
+    {
+        while(iDurableLsn < iLsn && !bFailed)
+        {
+            if(bFlushing)
+            {
+                flushDone.wait(lock);
+            }
+            else
+            {
+                flushLocked(lock, true);
+            }
+        }
+        if(iDurableLsn < iLsn) return 0;
+    }
+    else if(szBuffer.size() >= options.iBufferBytes && !flushLocked(lock, false))
+    {
+        return 0;
+    }
+    return iLsn;
+}
+
+/*********************************************************************
+uint64_t ManifestLog::logAdd(const string& szCust, const string& szItm, int iQty, Credits cost)
+Purpose:
+    Logs an addDelivery call.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item description
+    I int iQty - Quantity of items
+    I Credits cost - Cost of delivery
+Return Value:
+    uint64_t - Sequence number of the record, 0 if it was not logged
+Notes:
+    None
+*********************************************************************/
+uint64_t ManifestLog::logAdd(const string& szCust, const string& szItm, int iQty, Credits cost)
+{
+    return append(RECORD_ADD, szCust, szItm, iQty, cost);
+}
+
+/*********************************************************************
+uint64_t ManifestLog::logModify(const string& szCust, const string& szItm, int iNewQty, Credits newCost)
+Purpose:
+    Logs a successful modifyDelivery call.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item name
+    I int iNewQty - New quantity value
+    I Credits newCost - New cost value
+Return Value:
+    uint64_t - Sequence number of the record, 0 if it was not logged
+Notes:
+    None
+*********************************************************************/
+uint64_t ManifestLog::logModify(const string& szCust, const string& szItm, int iNewQty, Credits newCost)
+{
+    return append(RECORD_MODIFY, szCust, szItm, iNewQty, newCost);
+}
+
+/*********************************************************************
+uint64_t ManifestLog::logRemove(const string& szCust, const string& szItm)
+Purpose:
+    Logs a successful removeDelivery call.
+Parameters:
+    I const string& szCust - Customer name
+    I const string& szItm - Item name
+Return Value:
+    uint64_t - Sequence number of the record, 0 if it was not logged
+Notes:
+    None
+*********************************************************************/
+uint64_t ManifestLog::logRemove(const string& szCust, const string& szItm)
+{
+    return append(RECORD_REMOVE, szCust, szItm, 0, Credits());
+}
+
+/*********************************************************************
+void ManifestLog::sync()
+Purpose:
+    Writes and fsyncs every record appended so far.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Use with Buffered mode at points that must be durable.
+*********************************************************************/
+void ManifestLog::sync()
+{
+    std::unique_lock<std::mutex> lock(logMutex);
+    if(iFd >= 0 && iDurableLsn < iLastLsn) flushLocked(lock, true);
+}
+
+/*********************************************************************
+void ManifestLog::discard()
+Purpose:
+    Throws away every record, e.g. when a shift ends cleanly.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Sequence numbers keep counting up.
+*********************************************************************/
+void ManifestLog::discard()
+{
+    std::unique_lock<std::mutex> lock(logMutex);
+    while(bFlushing) flushDone.wait(lock);
+
+    szBuffer.clear();
+    if(iFd >= 0 && ::ftruncate(iFd, 0) == 0)
+    {
+        ::fdatasync(iFd);
+        iFileBytes = 0;
+    }
+    iBufferedLsn = iLastLsn;
+    iDurableLsn = iLastLsn;
+}
+
+/*********************************************************************
+bool ManifestLog::hasFailed()
+Purpose:
+    Whether a write or fsync has failed.
+Parameters:
+    None
+Return Value:
+    bool - True once the log has stopped accepting records
+Notes:
+    Records appended before the failure and not yet durable are kept
+    in memory only.
+*********************************************************************/
+bool ManifestLog::hasFailed()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    return bFailed;
+}
+
+/*********************************************************************
+uint64_t ManifestLog::getLastLsn()
+Purpose:
+    Sequence number of the newest record appended.
+Parameters:
+    None
+Return Value:
+    uint64_t - Newest sequence number, 0 if nothing was ever logged
+Notes:
+    None
+*********************************************************************/
+uint64_t ManifestLog::getLastLsn()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    return iLastLsn;
+}
+
+/*********************************************************************
+size_t ManifestLog::replay(const string& szPath, AirshipOrderList& orderList, uint64_t iAfterLsn, uint64_t* pLastLsn)
+Purpose:
+    Re-applies a log to an order list.
+Parameters:
+    I const string& szPath - Log file path
+    I/O AirshipOrderList& orderList - List to apply the records to
+    I uint64_t iAfterLsn - Skip records at or below this sequence number
+    O uint64_t* pLastLsn - Optional; receives the newest sequence number seen
+Return Value:
+    size_t - Number of records applied
+Notes:
+    Works on checkpoints as well as logs. A missing file replays
+    nothing. Replay stops quietly at a torn or corrupt record.
+    Consecutive records of the same type are applied through the
+    batch APIs, which match one-at-a-time semantics, so a long run of
+    modifies costs one list walk rather than one each.
+*********************************************************************/
+size_t ManifestLog::replay(const string& szPath, AirshipOrderList& orderList, uint64_t iAfterLsn, uint64_t* pLastLsn)
+{
+    std::string szLog = readFile(szPath);
+    size_t iApplied = 0;
+    uint64_t iNewest = iAfterLsn;
+    RecordType batchType = RECORD_ADD;
+    vector<DeliveryRecord> batch;
+
+    auto applyBatch = [&orderList, &batch, &batchType]()
+    {
+        if(batch.empty()) return;
+        switch(batchType)
+        {
+            case RECORD_ADD:
+                orderList.addDeliveries(batch);
+                break;
+
+            case RECORD_MODIFY:
+                orderList.modifyDeliveries(batch);
+                break;
+
+            case RECORD_REMOVE:
+                orderList.removeDeliveries(batch);
+                break;
+
+            case RECORD_CHECKPOINT:
+                break;
+        }
+        batch.clear();
+    };
+
+    forEachRecord(szLog, [&](RecordType type, uint64_t iLsn, const string& szName, const string& szItem, int iQuantity, Credits cost)
+    {
+        if(type == RECORD_CHECKPOINT && iLsn > iNewest) iNewest = iLsn;
+        if(iLsn <= iAfterLsn) return;
+        if(type != RECORD_ADD && type != RECORD_MODIFY && type != RECORD_REMOVE) return;
+        if(type != batchType) applyBatch();
+
+        batchType = type;
+        DeliveryRecord record;
+        record.szName = szName;
+        record.szItem = szItem;
+        record.iQuantity = iQuantity;
+        record.cost = cost;
+        batch.push_back(std::move(record));
+        iNewest = iLsn;
+        iApplied++;
+    });
+    applyBatch();
+
+    if(pLastLsn != nullptr) *pLastLsn = iNewest;
+    return iApplied;
+}
+
+/*********************************************************************
+void ManifestLog::advanceLsn(uint64_t iLsn)
+Purpose:
+    Makes sure new records are numbered after iLsn.
+Parameters:
+    I uint64_t iLsn - Newest sequence number already recovered
+Return Value:
+    None
+Notes:
+    Needed after recovering from a checkpoint, since the active log
+    may be empty and would otherwise start again from 1.
+*********************************************************************/
+void ManifestLog::advanceLsn(uint64_t iLsn)
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    if(iLsn <= iLastLsn) return;
+    iLastLsn = iLsn;
+    iBufferedLsn = std::max(iBufferedLsn, iLsn);
+    iDurableLsn = std::max(iDurableLsn, iLsn);
+}
+
+/*********************************************************************
+bool ManifestLog::rotate()
+Purpose:
+    Seals the active log as a segment and starts a new active file.
+Parameters:
+    None
+Return Value:
+    bool - True if a segment was sealed, false if nothing was new
+Notes:
+    Appenders wait only for the final fsync and rename. Gives up and
+    returns false if writes keep failing or keep racing in. The sealed
+    file is named after its newest sequence number so segments sort
+    in log order. An empty active file is never sealed: after
+    recovery advanceLsn() can make iLastLsn name a segment that is
+    still on disk, and sealing would rename over it.
+*********************************************************************/
+bool ManifestLog::rotate()
+{
+    const int MAX_FLUSH_ATTEMPTS = 8;
+    std::unique_lock<std::mutex> lock(logMutex);
+    if(iFd < 0) return false;
+
+    for(int i = 0; i < MAX_FLUSH_ATTEMPTS && (bFlushing || !szBuffer.empty() || iDurableLsn < iLastLsn); i++)
+    {
+        if(!flushLocked(lock, true)) return false;
+    }
+    if(bFlushing || !szBuffer.empty() || iDurableLsn < iLastLsn) return false;
+    if(iLastLsn == iSealedLsn || iFileBytes == 0) return false;
+
+    string szSegment = segmentPath(szLogPath, iLastLsn);
+    std::error_code error;
+    if(std::filesystem::exists(szSegment, error) || error) return false;
+
+    ::close(iFd);
+    if(std::rename(szLogPath.c_str(), szSegment.c_str()) != 0)
+    {
+        iFd = ::open(szLogPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        return false;
+    }
+    iSealedLsn = iLastLsn;
+    iFileBytes = 0;
+    iFd = ::open(szLogPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    return true;
+}
+
+/*********************************************************************
+string ManifestLog::segmentPath(const string& szPath, uint64_t iLsn)
+Purpose:
+    Name of the sealed segment ending at sequence number iLsn.
+Parameters:
+    I const string& szPath - Active log path
+    I uint64_t iLsn - Newest sequence number in the segment
+Return Value:
+    string - Segment path
+Notes:
+    Zero padded so names sort numerically.
+*********************************************************************/
+string ManifestLog::segmentPath(const string& szPath, uint64_t iLsn)
+{
+    char szSuffix[32];
+    std::snprintf(szSuffix, sizeof(szSuffix), ".%020llu", static_cast<unsigned long long>(iLsn));
+    return szPath + szSuffix;
+}
+
+/*********************************************************************
+vector<string> ManifestLog::sealedSegments(const string& szPath)
+Purpose:
+    Lists the sealed segments of a log, oldest first.
+Parameters:
+    I const string& szPath - Active log path
+Return Value:
+    vector<string> - Segment paths in log order
+Notes:
+    None
+*********************************************************************/
+vector<string> ManifestLog::sealedSegments(const string& szPath)
+{
+    namespace fs = std::filesystem;
+    fs::path logPath(szPath);
+    fs::path directory = logPath.has_parent_path() ? logPath.parent_path() : fs::path(".");
+    string szPrefix = logPath.filename().string() + ".";
+    const size_t DIGITS = 20;
+
+    vector<string> segments;
+    std::error_code error;
+    for(const fs::directory_entry& entry : fs::directory_iterator(directory, error))
+    {
+        string szName = entry.path().filename().string();
+        if(szName.size() == szPrefix.size() + DIGITS && szName.compare(0, szPrefix.size(), szPrefix) == 0 &&
+           szName.find_first_not_of("0123456789", szPrefix.size()) == string::npos)
+        {
+            segments.push_back(entry.path().string());
+        }
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+/*********************************************************************
+bool ManifestLog::writeCheckpoint(const string& szPath, const AirshipOrderList& orderList, uint64_t iLsn)
+Purpose:
+    Atomically replaces a checkpoint with the contents of a list.
+Parameters:
+    I const string& szPath - Checkpoint path
+    I const AirshipOrderList& orderList - Manifest as of iLsn
+    I uint64_t iLsn - Newest log record reflected in orderList
+Return Value:
+    bool - True once the checkpoint is durable
+Notes:
+    A checkpoint is an ordinary log: a RECORD_CHECKPOINT marker
+    carrying iLsn, then one add per delivery. It is written to a
+    temporary file, fsynced and renamed over the old one, so readers
+    only ever see a complete checkpoint.
+*********************************************************************/
+bool ManifestLog::writeCheckpoint(const string& szPath, const AirshipOrderList& orderList, uint64_t iLsn)
+{
+    std::string szImage;
+    encodeRecord(szImage, RECORD_CHECKPOINT, iLsn, string(), string(), 0, Credits());
+    for(const Delivery* current = orderList.getHead(); current != nullptr; current = current->pNext)
+    {
+        encodeRecord(szImage, RECORD_ADD, iLsn, current->szName, current->szItem, current->iQuantity, current->cost);
+    }
+
+    string szTempPath = szPath + ".tmp";
+    int iTempFd = ::open(szTempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(iTempFd < 0) return false;
+    bool bOk = writeAll(iTempFd, szImage) && ::fsync(iTempFd) == 0;
+    ::close(iTempFd);
+    if(!bOk || std::rename(szTempPath.c_str(), szPath.c_str()) != 0)
+    {
+        std::remove(szTempPath.c_str());
+        return false;
+    }
+
+    std::filesystem::path directory = std::filesystem::path(szPath).parent_path();
+    int iDirFd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if(iDirFd >= 0)
+    {
+        ::fsync(iDirFd);
+        ::close(iDirFd);
+    }
+    return true;
+}
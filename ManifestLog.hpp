@@ -0,0 +1,129 @@
+/*********************************************************************
+File name: ManifestLog.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the ManifestLog class, an append-only write-ahead
+    log of manifest mutations.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for ManifestLog.
+Notes:
+    Replaying the log rebuilds an AirshipOrderList after a crash.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+/*********************************************************************
+Enum Name: LogSyncMode
+Purpose:
+    How hard ManifestLog works to get records onto disk.
+Notes:
+    GroupCommit is the durable setting; Periodic bounds the loss
+    window to iSyncIntervalMs; Buffered only survives a process crash,
+    not a power loss.
+*********************************************************************/
+enum class LogSyncMode
+{
+    Buffered,       // write() when the buffer fills, never fsync
+    Periodic,       // background fsync every iSyncIntervalMs
+    GroupCommit     // append returns once its record is fsynced
+};
+
+/*********************************************************************
+Struct Name: ManifestLogOptions
+Purpose:
+    Tunable durability settings for ManifestLog.
+Notes:
+    None
+*********************************************************************/
+struct ManifestLogOptions
+{
+    LogSyncMode syncMode = LogSyncMode::GroupCommit;  // Durability setting
+    int iSyncIntervalMs = 10;                         // Periodic mode fsync interval
+    size_t iBufferBytes = 64 * 1024;                  // Buffered bytes before a write()
+};
+
+/*********************************************************************
+Class Name: ManifestLog
+Purpose:
+    Append-only log of add, modify and remove operations.
+Notes:
+    Each record is length-prefixed and checksummed, so a record torn
+    by a crash ends replay cleanly. rotate() seals the active file as
+    a numbered segment so ManifestCheckpointer can fold it into a
+    checkpoint and delete it. In GroupCommit mode the first
+    appender to find no flush in progress becomes the leader and
+    fsyncs everything buffered so far; appenders arriving meanwhile
+    wait and are covered by the next leader's single fsync. A failed
+    write or fsync stops the log; appends then return 0.
+*********************************************************************/
+class ManifestLog
+{
+    public:
+        enum RecordType : uint8_t
+        {
+            RECORD_ADD = 1,
+            RECORD_MODIFY = 2,
+            RECORD_REMOVE = 3,
+            RECORD_CHECKPOINT = 4
+        };
+
+    private:
+        string szLogPath;                      // Active log file path
+        int iFd = -1;                          // Log file descriptor
+        ManifestLogOptions options;            // Durability settings
+        std::mutex logMutex;                   // Guards every member below
+        std::condition_variable flushDone;     // Signalled after each flush
+        std::condition_variable stopRequested; // Wakes the sync thread for shutdown
+        std::string szBuffer;                  // Encoded records not yet written
+        std::string szWriteBuffer;             // Records being written by the leader
+        uint64_t iLastLsn = 0;                 // Sequence number of the newest record
+        uint64_t iBufferedLsn = 0;             // Newest record already handed to write()
+        uint64_t iDurableLsn = 0;              // Newest record known to be fsynced
+        uint64_t iSealedLsn = 0;               // Newest record moved into a sealed segment
+        off_t iFileBytes = 0;                  // Length of the whole records in the active file
+        bool bFlushing = false;                // A leader is writing right now
+        bool bFailed = false;                  // A write or fsync failed; nothing more is written
+        bool bStopping = false;                // Tells the sync thread to exit
+        std::thread syncThread;                // Periodic mode fsync thread
+
+        uint64_t append(RecordType type, const string& szCust, const string& szItm, int iQty, Credits cost);
+        bool flushLocked(std::unique_lock<std::mutex>& lock, bool bSync);
+        void runSyncThread();
+
+    public:
+        ManifestLog(const string& szPath, const ManifestLogOptions& logOptions = ManifestLogOptions());
+        ~ManifestLog();
+        ManifestLog(const ManifestLog&) = delete;
+        ManifestLog& operator=(const ManifestLog&) = delete;
+
+        uint64_t logAdd(const string& szCust, const string& szItm, int iQty, Credits cost);
+        uint64_t logModify(const string& szCust, const string& szItm, int iNewQty, Credits newCost);
+        uint64_t logRemove(const string& szCust, const string& szItm);
+        void sync();
+        void discard();
+        bool hasFailed();
+        uint64_t getLastLsn();
+        void advanceLsn(uint64_t iLsn);
+        bool rotate();
+        bool isOpen() const { return iFd >= 0; }
+        const string& getPath() const { return szLogPath; }
+
+        static size_t replay(const string& szPath, AirshipOrderList& orderList, uint64_t iAfterLsn = 0, uint64_t* pLastLsn = nullptr);
+        static string segmentPath(const string& szPath, uint64_t iLsn);
+        static vector<string> sealedSegments(const string& szPath);
+        static bool writeCheckpoint(const string& szPath, const AirshipOrderList& orderList, uint64_t iLsn);
+};
@@ -0,0 +1,295 @@
+/*********************************************************************
+File name: OutputSink.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the OutputSink classes.
+Command Parameters:
+    N/A
+Input:
+    Formatted game output.
+Results:
+    Output written to a descriptor, a transcript file, or nowhere.
+Notes:
+    A zero-byte buffer writes every insertion straight through, which
+    is how the old unbuffered terminal output behaved.
+*********************************************************************/
+
+#include "OutputSink.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    /*********************************************************************
+    bool writeAll(int iFd, const char* pData, size_t iLength)
+    Purpose:
+        Writes the whole range, retrying short and interrupted writes.
+    *********************************************************************/
+    bool writeAll(int iFd, const char* pData, size_t iLength)
+    {
+        while(iLength > 0)
+        {
+            ssize_t iWritten = ::write(iFd, pData, iLength);
+            if(iWritten < 0)
+            {
+                if(errno == EINTR) continue;
+                return false;
+            }
+            pData += iWritten;
+            iLength -= static_cast<size_t>(iWritten);
+        }
+        return true;
+    }
+}
+
+/*********************************************************************
+OutputSink::OutputSink(size_t iBufferBytes)
+Purpose:
+    Constructor that sets up the put area.
+Parameters:
+    I size_t iBufferBytes - Bytes buffered before a forced write
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+OutputSink::OutputSink(size_t iBufferBytes) : buffer(iBufferBytes)
+{
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+/*********************************************************************
+bool OutputSink::drain()
+Purpose:
+    Hands everything buffered to writeOut() and empties the buffer.
+Parameters:
+    None
+Return Value:
+    bool - False if writeOut() failed
+Notes:
+    None
+*********************************************************************/
+bool OutputSink::drain()
+{
+    size_t iPending = static_cast<size_t>(pptr() - pbase());
+    if(iPending == 0) return true;
+
+    iWriteCalls++;
+    bool bOk = writeOut(pbase(), iPending);
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return bOk;
+}
+
+/*********************************************************************
+OutputSink::int_type OutputSink::overflow(int_type ch)
+Purpose:
+    Called when the buffer is full; drains it and stores ch.
+Parameters:
+    I int_type ch - Character that did not fit, or eof
+Return Value:
+    int_type - ch on success, eof on failure
+Notes:
+    None
+*********************************************************************/
+OutputSink::int_type OutputSink::overflow(int_type ch)
+{
+    if(!drain()) return traits_type::eof();
+    if(traits_type::eq_int_type(ch, traits_type::eof())) return traits_type::not_eof(ch);
+
+    char c = traits_type::to_char_type(ch);
+    if(pptr() == epptr())
+    {
+        iWriteCalls++;
+        return writeOut(&c, 1) ? ch : traits_type::eof();
+    }
+    *pptr() = c;
+    pbump(1);
+    return ch;
+}
+
+/*********************************************************************
+std::streamsize OutputSink::xsputn(const char* pData, std::streamsize iLength)
+Purpose:
+    Appends a run of characters.
+Parameters:
+    I const char* pData - Characters to append
+    I std::streamsize iLength - Number of characters
+Return Value:
+    std::streamsize - Number of characters accepted
+Notes:
+    Runs larger than the buffer go straight to writeOut().
+*********************************************************************/
+std::streamsize OutputSink::xsputn(const char* pData, std::streamsize iLength)
+{
+    size_t iCount = static_cast<size_t>(iLength);
+    size_t iSpace = static_cast<size_t>(epptr() - pptr());
+    if(iCount <= iSpace)
+    {
+        std::memcpy(pptr(), pData, iCount);
+        pbump(static_cast<int>(iCount));
+        return iLength;
+    }
+
+    if(!drain()) return 0;
+    if(iCount >= buffer.size())
+    {
+        iWriteCalls++;
+        return writeOut(pData, iCount) ? iLength : 0;
+    }
+    std::memcpy(pptr(), pData, iCount);
+    pbump(static_cast<int>(iCount));
+    return iLength;
+}
+
+/*********************************************************************
+int OutputSink::sync()
+Purpose:
+    Flushes the buffer; called by std::ostream::flush().
+Parameters:
+    None
+Return Value:
+    int - 0 on success, -1 on failure
+Notes:
+    None
+*********************************************************************/
+int OutputSink::sync()
+{
+    return drain() ? 0 : -1;
+}
+
+/*********************************************************************
+OutputSink& OutputSink::standardOutput()
+Purpose:
+    Shared sink on standard output.
+Parameters:
+    None
+Return Value:
+    OutputSink& - FdSink on descriptor 1
+Notes:
+    Flushed when the program exits.
+*********************************************************************/
+OutputSink& OutputSink::standardOutput()
+{
+    static FdSink sink(1);
+    return sink;
+}
+
+/*********************************************************************
+FdSink::FdSink(int iFileDescriptor, size_t iBufferBytes)
+Purpose:
+    Constructor for a sink on an open descriptor.
+Parameters:
+    I int iFileDescriptor - Destination descriptor
+    I size_t iBufferBytes - Bytes buffered before a forced write
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+FdSink::FdSink(int iFileDescriptor, size_t iBufferBytes) : OutputSink(iBufferBytes), iFd(iFileDescriptor) {}
+
+/*********************************************************************
+FdSink::~FdSink()
+Purpose:
+    Destructor that flushes pending output.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    Derived destructors must flush, since writeOut() is gone by the
+    time the base destructor runs.
+*********************************************************************/
+FdSink::~FdSink()
+{
+    pubsync();
+}
+
+/*********************************************************************
+bool FdSink::writeOut(const char* pData, size_t iLength)
+Purpose:
+    Writes a block to the descriptor.
+Parameters:
+    I const char* pData - Bytes to write
+    I size_t iLength - Number of bytes
+Return Value:
+    bool - True if everything was written
+Notes:
+    None
+*********************************************************************/
+bool FdSink::writeOut(const char* pData, size_t iLength)
+{
+    return writeAll(iFd, pData, iLength);
+}
+
+/*********************************************************************
+FileSink::FileSink(const std::string& szPath, size_t iBufferBytes)
+Purpose:
+    Constructor that creates (or truncates) a transcript file.
+Parameters:
+    I const std::string& szPath - Transcript path
+    I size_t iBufferBytes - Bytes buffered before a forced write
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+FileSink::FileSink(const std::string& szPath, size_t iBufferBytes) :
+    OutputSink(iBufferBytes), iFd(::open(szPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)) {}
+
+/*********************************************************************
+FileSink::~FileSink()
+Purpose:
+    Destructor that flushes and closes the transcript.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    None
+*********************************************************************/
+FileSink::~FileSink()
+{
+    pubsync();
+    if(iFd >= 0) ::close(iFd);
+}
+
+/*********************************************************************
+bool FileSink::writeOut(const char* pData, size_t iLength)
+Purpose:
+    Appends a block to the transcript.
+Parameters:
+    I const char* pData - Bytes to write
+    I size_t iLength - Number of bytes
+Return Value:
+    bool - True if everything was written
+Notes:
+    None
+*********************************************************************/
+bool FileSink::writeOut(const char* pData, size_t iLength)
+{
+    return iFd >= 0 && writeAll(iFd, pData, iLength);
+}
+
+/*********************************************************************
+bool NullSink::writeOut(const char* pData, size_t iLength)
+Purpose:
+    Discards a block.
+Parameters:
+    I const char* pData - Ignored
+    I size_t iLength - Ignored
+Return Value:
+    bool - Always true
+Notes:
+    None
+*********************************************************************/
+bool NullSink::writeOut(const char* pData, size_t iLength)
+{
+    (void)pData;
+    (void)iLength;
+    return true;
+}
@@ -0,0 +1,115 @@
+/*********************************************************************
+File name: OutputSink.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the OutputSink classes, the buffered destinations
+    for all game output.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definitions for OutputSink, FdSink, FileSink and NullSink.
+Notes:
+    Sinks are stream buffers, so GameManager still formats with <<.
+*********************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/*********************************************************************
+Class Name: OutputSink
+Purpose:
+    Stream buffer that collects output in one large buffer and hands
+    it to writeOut() only when flushed or full.
+Notes:
+    GameManager flushes once per prompt (through the InputReader tie),
+    so a whole screen goes out in a single write.
+*********************************************************************/
+class OutputSink : public std::streambuf
+{
+    private:
+        std::vector<char> buffer;     // Pending output
+        size_t iWriteCalls = 0;       // Number of writeOut() calls made
+
+        bool drain();
+
+    protected:
+        virtual bool writeOut(const char* pData, size_t iLength) = 0;
+
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* pData, std::streamsize iLength) override;
+        int sync() override;
+
+    public:
+        explicit OutputSink(size_t iBufferBytes = 64 * 1024);
+        virtual ~OutputSink() = default;
+        OutputSink(const OutputSink&) = delete;
+        OutputSink& operator=(const OutputSink&) = delete;
+
+        size_t getWriteCalls() const { return iWriteCalls; }
+
+        static OutputSink& standardOutput();
+};
+
+/*********************************************************************
+Class Name: FdSink
+Purpose:
+    Sink that writes to a file descriptor with write(2).
+Notes:
+    The descriptor is not closed by the sink.
+*********************************************************************/
+class FdSink : public OutputSink
+{
+    private:
+        int iFd;   // Destination descriptor
+
+    protected:
+        bool writeOut(const char* pData, size_t iLength) override;
+
+    public:
+        explicit FdSink(int iFileDescriptor, size_t iBufferBytes = 64 * 1024);
+        ~FdSink() override;
+};
+
+/*********************************************************************
+Class Name: FileSink
+Purpose:
+    Sink that records output to a transcript file.
+Notes:
+    Check isOpen() after construction.
+*********************************************************************/
+class FileSink : public OutputSink
+{
+    private:
+        int iFd;   // Transcript descriptor
+
+    protected:
+        bool writeOut(const char* pData, size_t iLength) override;
+
+    public:
+        explicit FileSink(const std::string& szPath, size_t iBufferBytes = 64 * 1024);
+        ~FileSink() override;
+        bool isOpen() const { return iFd >= 0; }
+};
+
+/*********************************************************************
+Class Name: NullSink
+Purpose:
+    Sink that discards everything, for benchmarks and headless runs.
+Notes:
+    Still counts flushes so write call totals can be compared.
+*********************************************************************/
+class NullSink : public OutputSink
+{
+    protected:
+        bool writeOut(const char* pData, size_t iLength) override;
+
+    public:
+        explicit NullSink(size_t iBufferBytes = 64 * 1024) : OutputSink(iBufferBytes) {}
+};
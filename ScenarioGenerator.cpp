@@ -0,0 +1,438 @@
+/*********************************************************************
+File name: ScenarioGenerator.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the ScenarioGenerator class.
+Command Parameters:
+    N/A
+Input:
+    A seed, a customer count and a fraud count.
+Results:
+    Generated customers, orders, clues and player scripts.
+Notes:
+    None
+*********************************************************************/
+
+#include "ScenarioGenerator.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace
+{
+    const char* const FIRST_NAMES[] = { "Bulk", "Buck", "Ripple", "Bramble", "Vesper", "Linton", "Marlow", "Tansy",
+                                        "Corvin", "Hazel", "Otto", "Wren", "Dorian", "Juniper", "Silas", "Mabel",
+                                        "Fenwick", "Ivy", "Gideon", "Rosalind", "Thaddeus", "Clover", "Ansel", "Poppy",
+                                        "Barnaby", "Odette", "Cassius", "Fern", "Lucan", "Imelda", "Rufus", "Delphine" };
+    const char* const LAST_NAMES[] = { "Ryker", "Hawthorne", "Nett", "Morrow", "Yarrow", "Quill", "Ashby", "Thorne",
+                                       "Pike", "Calloway", "Birch", "Mercer", "Vale", "Holloway", "Fairweather", "Crane",
+                                       "Locke", "Winslow", "Drummond", "Sparrow", "Kettle", "Blackwood", "Marsh", "Tully",
+                                       "Greaves", "Penhallow", "Rook", "Sterling", "Haddock", "Whitlock", "Bellamy", "Osgood" };
+    const size_t NAME_POOL = 32;   // Entries in each name list
+
+    /*********************************************************************
+    Struct Name: CatalogItem
+    Purpose:
+        An item customers ship and what one unit is worth.
+    *********************************************************************/
+    struct CatalogItem
+    {
+        std::string_view szName;   // Item description
+        double dUnitPrice;         // Reference price of one unit
+    };
+
+    const CatalogItem CATALOG[] = {
+        { "Protein Infusion Canisters", 95.0 }, { "Classic Ale Keg", 90.0 }, { "Net-Stabilizer Kit", 60.0 },
+        { "Cultivation Spore Beds", 50.0 }, { "EM Field Sensor", 240.0 }, { "Soft-Code Debugging Array", 320.0 },
+        { "Aether Compass", 180.0 }, { "Brass Gyroscope", 145.0 }, { "Cloudglass Lantern", 35.0 },
+        { "Ballast Sandbags", 12.0 }, { "Signal Flare Crate", 48.0 }, { "Tinctures of Vigor", 22.0 },
+        { "Mooring Line Spool", 30.0 }, { "Weather Balloon", 75.0 }, { "Copper Wiring Coil", 18.0 },
+        { "Star Chart Folio", 210.0 }, { "Rivet Gun", 130.0 }, { "Hydrogen Cell", 400.0 },
+        { "Pressure Gauge", 65.0 }, { "Galley Spice Tin", 15.0 }, { "Silk Envelope", 55.0 },
+        { "Clockwork Parrot", 260.0 }, { "Tarnished Sextant", 115.0 }, { "Storm Shutter Panel", 85.0 } };
+    const size_t CATALOG_SIZE = sizeof(CATALOG) / sizeof(CATALOG[0]);
+
+    const char* const REMARKS[] = { "Rain's picking up. Best load quick, Captain.",
+                                    "Mind the crate. It's heavier than it looks.",
+                                    "Same dock, same rain, same paperwork.",
+                                    "Wake me when we're airborne." };
+    const size_t REMARK_COUNT = sizeof(REMARKS) / sizeof(REMARKS[0]);
+
+    const std::string_view SPRITE = R"(
+          .---.              .//|\\.              .---.
+________ / .-. \_________..-~ _.-._ ~-..________ / .-. \_________
+         \ ~-~ /   /H-     `-=.___.=-'     -H\   \ ~-~ /
+           ~~~    / H          [H]          H \    ~~~
+)";
+
+    enum Salt : uint64_t { SALT_ITEM = 1, SALT_QUANTITY, SALT_PRICE, SALT_ACCUSE, SALT_CLUE, SALT_FRAUD };
+
+    /*********************************************************************
+    uint64_t mix(uint64_t iValue)
+    Purpose:
+        splitmix64 finalizer; spreads a counter over all 64 bits.
+    *********************************************************************/
+    uint64_t mix(uint64_t iValue)
+    {
+        iValue += 0x9E3779B97F4A7C15ULL;
+        iValue = (iValue ^ (iValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        iValue = (iValue ^ (iValue >> 27)) * 0x94D049BB133111EBULL;
+        return iValue ^ (iValue >> 31);
+    }
+
+    /*********************************************************************
+    double unitInterval(uint64_t iRandom)
+    Purpose:
+        Maps a random value to [0, 1).
+    *********************************************************************/
+    double unitInterval(uint64_t iRandom)
+    {
+        return static_cast<double>(iRandom >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /*********************************************************************
+    void appendNumber(std::string& szOut, size_t iValue)
+    Purpose:
+        Appends an integer without a temporary string.
+    *********************************************************************/
+    void appendNumber(std::string& szOut, size_t iValue)
+    {
+        char szDigits[24];
+        szOut.append(szDigits, static_cast<size_t>(std::to_chars(szDigits, szDigits + sizeof(szDigits), iValue).ptr - szDigits));
+    }
+}
+
+/*********************************************************************
+ScenarioGenerator::ScenarioGenerator(uint64_t iScenarioSeed, size_t iCustomerCount, size_t iFraudCount)
+Purpose:
+    Constructor that picks where the frauds are planted.
+Parameters:
+    I uint64_t iScenarioSeed - Seed every detail is derived from
+    I size_t iCustomerCount - Customers in the shift, at least 1
+    I size_t iFraudCount - Planted fraudulent orders, clamped to 1..N
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+ScenarioGenerator::ScenarioGenerator(uint64_t iScenarioSeed, size_t iCustomerCount, size_t iFraudCount) :
+    iSeed(iScenarioSeed), iCustomers(std::max<size_t>(iCustomerCount, 1))
+{
+    iFraudCount = std::clamp<size_t>(iFraudCount, 1, iCustomers);
+    for(uint64_t iDraw = 0; fraudulent.size() < iFraudCount; iDraw++)
+    {
+        size_t iCustomer = static_cast<size_t>(hash(static_cast<size_t>(iDraw), SALT_FRAUD) % iCustomers);
+        if(std::find(fraudulent.begin(), fraudulent.end(), iCustomer) == fraudulent.end()) fraudulent.push_back(iCustomer);
+    }
+    std::sort(fraudulent.begin(), fraudulent.end());
+
+    for(size_t iCustomer : fraudulent)
+    {
+        fraudulentNames.emplace_back();
+        appendName(iCustomer, fraudulentNames.back());
+    }
+}
+
+/*********************************************************************
+uint64_t ScenarioGenerator::hash(size_t iCustomer, uint64_t iSalt) const
+Purpose:
+    Random value for one decision about one customer.
+Parameters:
+    I size_t iCustomer - Customer position
+    I uint64_t iSalt - Which decision
+Return Value:
+    uint64_t - Value that depends only on the seed, customer and salt
+Notes:
+    None
+*********************************************************************/
+uint64_t ScenarioGenerator::hash(size_t iCustomer, uint64_t iSalt) const
+{
+    return mix(mix(iSeed ^ (iSalt << 56)) + iCustomer);
+}
+
+/*********************************************************************
+void ScenarioGenerator::appendName(size_t iCustomer, std::string& szOut) const
+Purpose:
+    Writes a customer's name.
+Parameters:
+    I size_t iCustomer - Customer position
+    I/O std::string& szOut - The name is appended to it
+Return Value:
+    None
+Notes:
+    The seed rotates both name lists, and each first name steps
+    through the last names at its own offset, so the first 1024
+    customers get distinct pairs. Past them a number keeps names
+    unique. Names stay under 31
+    characters so they are stored inline in the manifest.
+*********************************************************************/
+void ScenarioGenerator::appendName(size_t iCustomer, std::string& szOut) const
+{
+    size_t iFirst = (iCustomer + iSeed) % NAME_POOL;
+    size_t iLast = (iCustomer / NAME_POOL + (iCustomer % NAME_POOL) * 11 + (iSeed >> 8)) % NAME_POOL;
+    szOut += FIRST_NAMES[iFirst];
+    szOut += ' ';
+    szOut += LAST_NAMES[iLast];
+    if(iCustomer >= NAME_POOL * NAME_POOL)
+    {
+        szOut += ' ';
+        appendNumber(szOut, iCustomer / (NAME_POOL * NAME_POOL));
+    }
+}
+
+/*********************************************************************
+size_t ScenarioGenerator::itemOf(size_t iCustomer) const
+Purpose:
+    Picks a customer's catalog item.
+Parameters:
+    I size_t iCustomer - Customer position
+Return Value:
+    size_t - Index into the catalog
+Notes:
+    None
+*********************************************************************/
+size_t ScenarioGenerator::itemOf(size_t iCustomer) const
+{
+    return static_cast<size_t>(hash(iCustomer, SALT_ITEM) % CATALOG_SIZE);
+}
+
+/*********************************************************************
+size_t ScenarioGenerator::accusedBy(size_t iCustomer, bool bFraudulent) const
+Purpose:
+    Picks who a customer accuses.
+Parameters:
+    I size_t iCustomer - Customer position
+    I bool bFraudulent - The customer is a planted fraud
+Return Value:
+    size_t - Position of the accused customer
+Notes:
+    Honest customers name a fraudster half the time. Nobody accuses
+    themselves unless they are alone on the dock.
+*********************************************************************/
+size_t ScenarioGenerator::accusedBy(size_t iCustomer, bool bFraudulent) const
+{
+    uint64_t iRandom = hash(iCustomer, SALT_ACCUSE);
+    if(!bFraudulent && (iRandom & 1) != 0)
+    {
+        size_t iAccused = fraudulent[(iRandom >> 1) % fraudulent.size()];
+        if(iAccused != iCustomer) return iAccused;
+    }
+    if(iCustomers == 1) return 0;
+    size_t iAccused = static_cast<size_t>((iRandom >> 8) % (iCustomers - 1));
+    return iAccused >= iCustomer ? iAccused + 1 : iAccused;
+}
+
+/*********************************************************************
+bool ScenarioGenerator::isFraudulent(size_t iCustomer) const
+Purpose:
+    Tells whether a customer's order is a planted fraud.
+Parameters:
+    I size_t iCustomer - Customer position
+Return Value:
+    bool - True for a fraudulent order
+Notes:
+    None
+*********************************************************************/
+bool ScenarioGenerator::isFraudulent(size_t iCustomer) const
+{
+    return std::binary_search(fraudulent.begin(), fraudulent.end(), iCustomer);
+}
+
+/*********************************************************************
+bool ScenarioGenerator::isFraudulentName(std::string_view szName) const
+Purpose:
+    Tells whether a name belongs to a planted fraud.
+Parameters:
+    I std::string_view szName - Customer name as typed
+Return Value:
+    bool - True if removing that customer wins the shift
+Notes:
+    None
+*********************************************************************/
+bool ScenarioGenerator::isFraudulentName(std::string_view szName) const
+{
+    return std::find(fraudulentNames.begin(), fraudulentNames.end(), szName) != fraudulentNames.end();
+}
+
+/*********************************************************************
+void ScenarioGenerator::order(size_t iCustomer, ScenarioOrder& out) const
+Purpose:
+    Generates one customer's order.
+Parameters:
+    I size_t iCustomer - Customer position, below size()
+    O ScenarioOrder& out - Receives the order
+Return Value:
+    None
+Notes:
+    Costs are rounded to cents so they survive being typed back in.
+*********************************************************************/
+void ScenarioGenerator::order(size_t iCustomer, ScenarioOrder& out) const
+{
+    const CatalogItem& item = CATALOG[itemOf(iCustomer)];
+    out.szName.clear();
+    appendName(iCustomer, out.szName);
+    out.szItem = item.szName;
+    out.iQuantity = 1 + static_cast<int>(hash(iCustomer, SALT_QUANTITY) % 12);
+    out.dReferenceCost = item.dUnitPrice * out.iQuantity;
+    out.bFraudulent = isFraudulent(iCustomer);
+
+    double dPriceRoll = unitInterval(hash(iCustomer, SALT_PRICE));
+    double dFactor = out.bFraudulent ? 0.40 + 0.20 * dPriceRoll : 0.92 + 0.16 * dPriceRoll;
+    out.dCost = std::round(out.dReferenceCost * dFactor * 100.0) / 100.0;
+    out.iAccused = accusedBy(iCustomer, out.bFraudulent);
+    out.szHintedItem = std::string_view();
+}
+
+/*********************************************************************
+CustomerProfile ScenarioGenerator::profile(size_t iCustomer, ScenarioOrder& order, std::string& szClues) const
+Purpose:
+    Generates a customer's order and the clues their scene gives.
+Parameters:
+    I size_t iCustomer - Customer position, below size()
+    O ScenarioOrder& order - Receives the order the profile points into
+    O std::string& szClues - Receives the arrival, accusation and riddle
+Return Value:
+    CustomerProfile - Scene fields, viewing order and szClues
+Notes:
+    Every third customer has a riddle about a fraudulent item, or an
+    honest one when a fraudster tells it; the rest get a remark that
+    is no clue at all.
+*********************************************************************/
+CustomerProfile ScenarioGenerator::profile(size_t iCustomer, ScenarioOrder& order, std::string& szClues) const
+{
+    this->order(iCustomer, order);
+    uint64_t iRandom = hash(iCustomer, SALT_CLUE);
+
+    szClues.assign("January 17 – ");
+    size_t iMinutes = (12 + iCustomer * 7) % (24 * 60);
+    szClues += static_cast<char>('0' + iMinutes / 600);
+    szClues += static_cast<char>('0' + iMinutes / 60 % 10);
+    szClues += ':';
+    szClues += static_cast<char>('0' + iMinutes % 60 / 10);
+    szClues += static_cast<char>('0' + iMinutes % 10);
+    size_t iArrivalEnd = szClues.size();
+
+    size_t iAccusedItem = itemOf(order.iAccused);
+    size_t iNameStart = szClues.size();
+    appendName(order.iAccused, szClues);
+    if((iRandom & 1) != 0)
+    {
+        szClues += "? Wouldn't trust them to carry a postcard.";
+    }
+    else
+    {
+        szClues += "'s ";
+        szClues += CATALOG[iAccusedItem].szName;
+        szClues += " slip doesn't add up. Check it twice.";
+    }
+    size_t iAccusationEnd = szClues.size();
+
+    if((iRandom >> 1) % 3 == 0)
+    {
+        size_t iHinted = order.bFraudulent ? itemOf(accusedBy(iCustomer, true))
+                                           : itemOf(fraudulent[(iRandom >> 4) % fraudulent.size()]);
+        order.szHintedItem = CATALOG[iHinted].szName;
+        szClues += "The cheapest ";
+        szClues += order.szHintedItem;
+        szClues += " on this dock is the one that isn't real.";
+    }
+    else
+    {
+        szClues += REMARKS[(iRandom >> 4) % REMARK_COUNT];
+    }
+
+    std::string_view szText(szClues);
+    CustomerProfile profile;
+    profile.szName = order.szName;
+    profile.szArrival = szText.substr(0, iArrivalEnd);
+    profile.szItem = order.szItem;
+    profile.iQuantity = order.iQuantity;
+    profile.dCost = order.dCost;
+    profile.szAccusation = szText.substr(iNameStart, iAccusationEnd - iNameStart);
+    profile.szRiddle = szText.substr(iAccusationEnd);
+    profile.szSprite = SPRITE;
+    return profile;
+}
+
+/*********************************************************************
+void ScenarioGenerator::loadInto(AirshipOrderList& airshipOrderList) const
+Purpose:
+    Appends every generated order to a manifest.
+Parameters:
+    I/O AirshipOrderList& airshipOrderList - Manifest to fill
+Return Value:
+    None
+Notes:
+    Reserves pool space for the whole scenario first.
+*********************************************************************/
+void ScenarioGenerator::loadInto(AirshipOrderList& airshipOrderList) const
+{
+    airshipOrderList.reserve(airshipOrderList.size() + iCustomers);
+    ScenarioOrder current;
+    for(size_t iCustomer = 0; iCustomer < iCustomers; iCustomer++)
+    {
+        order(iCustomer, current);
+        airshipOrderList.addDelivery(current.szName, std::string(current.szItem), current.iQuantity, Credits::fromDouble(current.dCost));
+    }
+}
+
+/*********************************************************************
+void ScenarioGenerator::loadInto(AirshipOrderList& airshipOrderList, WorkStealingPool& workPool) const
+Purpose:
+    Appends every generated order to a manifest, generating and
+    building the nodes in parallel.
+Parameters:
+    I/O AirshipOrderList& airshipOrderList - Manifest to fill
+    I/O WorkStealingPool& workPool - Threads to generate on
+Return Value:
+    None
+Notes:
+    Same manifest as loadInto(airshipOrderList); customer i depends
+    only on the seed and i.
+*********************************************************************/
+void ScenarioGenerator::loadInto(AirshipOrderList& airshipOrderList, WorkStealingPool& workPool) const
+{
+    airshipOrderList.addDeliveries(iCustomers, workPool, [this](size_t iCustomer, DeliveryRecord& record)
+    {
+        thread_local ScenarioOrder current;
+        order(iCustomer, current);
+        record.szName.swap(current.szName);
+        record.szItem.assign(current.szItem);
+        record.iQuantity = current.iQuantity;
+        record.cost = Credits::fromDouble(current.dCost);
+    });
+}
+
+/*********************************************************************
+void ScenarioGenerator::writeScript(std::string& szScript) const
+Purpose:
+    Writes the player input that logs every customer correctly.
+Parameters:
+    O std::string& szScript - Receives the opening continue and, per
+                              customer, name, item, quantity, cost and
+                              a continue line
+Return Value:
+    None
+Notes:
+    The caller appends whatever guessing-menu input it wants to test.
+*********************************************************************/
+void ScenarioGenerator::writeScript(std::string& szScript) const
+{
+    szScript.assign("\n");
+    ScenarioOrder current;
+    char szCost[Credits::MAX_FORMATTED];
+    for(size_t iCustomer = 0; iCustomer < iCustomers; iCustomer++)
+    {
+        order(iCustomer, current);
+        szScript += current.szName;
+        szScript += '\n';
+        szScript += current.szItem;
+        szScript += '\n';
+        appendNumber(szScript, static_cast<size_t>(current.iQuantity));
+        szScript += '\n';
+        szScript.append(szCost, static_cast<size_t>(Credits::fromDouble(current.dCost).format(szCost) - szCost));
+        szScript += "\n\n";
+    }
+}
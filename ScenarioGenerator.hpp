@@ -0,0 +1,92 @@
+/*********************************************************************
+File name: ScenarioGenerator.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the ScenarioGenerator class, which makes seeded
+    shifts of any size for stress and load testing.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for ScenarioGenerator and struct definition for
+    ScenarioOrder.
+Notes:
+    The same seed and size always produce the same scenario.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include "CustomerProfile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*********************************************************************
+Struct Name: ScenarioOrder
+Purpose:
+    One generated customer and their order.
+Notes:
+    Reused between calls to ScenarioGenerator::order() so the name
+    buffer keeps its capacity.
+*********************************************************************/
+struct ScenarioOrder
+{
+    std::string szName;              // Customer name, unique within the scenario
+    std::string_view szItem;         // Item from the generator's catalog
+    int iQuantity = 0;               // Units shipped
+    double dCost = 0.0;              // Declared total cost
+    double dReferenceCost = 0.0;     // What the units are really worth
+    bool bFraudulent = false;        // Planted mispriced order
+    size_t iAccused = 0;             // Customer this one accuses
+    std::string_view szHintedItem;   // Item their riddle points at, set by profile()
+};
+
+/*********************************************************************
+Class Name: ScenarioGenerator
+Purpose:
+    Describes a shift of N customers with catalog items, reference
+    prices, planted fraudulent (underpriced) orders and clues that
+    point at them.
+Notes:
+    Nothing is stored per customer: order() derives customer i from
+    the seed and i with a counter-based hash, so a 10M order scenario
+    costs only its list of fraudulent positions. Honest costs are
+    within 8% of the reference price; fraudulent ones are 40-60% of
+    it. Half of the honest customers accuse a fraudster and every
+    third one adds a riddle about the fraudulent item; fraudsters
+    accuse honest customers.
+*********************************************************************/
+class ScenarioGenerator
+{
+    private:
+        uint64_t iSeed;                            // Scenario seed
+        size_t iCustomers;                         // Customers in the shift
+        std::vector<size_t> fraudulent;            // Positions of planted frauds, ascending
+        std::vector<std::string> fraudulentNames;  // Names of those customers
+
+        uint64_t hash(size_t iCustomer, uint64_t iSalt) const;
+        void appendName(size_t iCustomer, std::string& szOut) const;
+        size_t itemOf(size_t iCustomer) const;
+        size_t accusedBy(size_t iCustomer, bool bFraudulent) const;
+
+    public:
+        ScenarioGenerator(uint64_t iScenarioSeed, size_t iCustomerCount, size_t iFraudCount = 1);
+
+        size_t size() const { return iCustomers; }
+        uint64_t getSeed() const { return iSeed; }
+        const std::vector<size_t>& getFraudulent() const { return fraudulent; }
+        const std::string& getFraudulentName() const { return fraudulentNames.front(); }
+        bool isFraudulent(size_t iCustomer) const;
+        bool isFraudulentName(std::string_view szName) const;
+
+        void order(size_t iCustomer, ScenarioOrder& out) const;
+        CustomerProfile profile(size_t iCustomer, ScenarioOrder& order, std::string& szClues) const;
+        void loadInto(AirshipOrderList& airshipOrderList) const;
+        void loadInto(AirshipOrderList& airshipOrderList, WorkStealingPool& workPool) const;
+        void writeScript(std::string& szScript) const;
+};
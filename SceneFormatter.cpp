@@ -0,0 +1,174 @@
+/*********************************************************************
+File name: SceneFormatter.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the SceneFormatter class.
+Command Parameters:
+    N/A
+Input:
+    A layout template and customer profiles.
+Results:
+    Rendered customer scenes.
+Notes:
+    None
+*********************************************************************/
+
+#include "SceneFormatter.hpp"
+#include "Credits.hpp"
+#include <charconv>
+
+const std::string_view SceneFormatter::DEFAULT_LAYOUT = R"({sprite}
+──────────────────────────────────────────────
+   [{arrival}, {name} Arrives]
+──────────────────────────────────────────────
+
+{name} sets a crate on the deck and slides the slip across.
+
+{name}: "{item}. {qty} units. Cost: {cost}."
+
+{name} glances across the hangar.
+
+{name}: "{accusation}"
+
+{name}: "{riddle}"
+
+You log:
+    Name: {name} |
+    Item: {item} |
+    Qty: {qty} |
+    Cost: {cost} |
+)";
+
+/*********************************************************************
+SceneFormatter::SceneFormatter(std::string_view szLayoutText)
+Purpose:
+    Constructor that parses a layout into segments.
+Parameters:
+    I std::string_view szLayoutText - Scene text with {field} placeholders
+Return Value:
+    None (constructor)
+Notes:
+    Unknown placeholders stay inside the surrounding literal.
+*********************************************************************/
+SceneFormatter::SceneFormatter(std::string_view szLayoutText) : szLayout(szLayoutText)
+{
+    size_t iLiteralStart = 0;
+    size_t iPos = 0;
+    while((iPos = szLayout.find('{', iPos)) != std::string::npos)
+    {
+        size_t iClose = szLayout.find('}', iPos + 1);
+        if(iClose == std::string::npos) break;
+
+        Field field = fieldNamed(std::string_view(szLayout).substr(iPos + 1, iClose - iPos - 1));
+        if(field == Field::Literal)
+        {
+            iPos++;
+            continue;
+        }
+        addLiteral(iLiteralStart, iPos - iLiteralStart);
+        segments.push_back(Segment{ field, 0, 0 });
+        iPos = iClose + 1;
+        iLiteralStart = iPos;
+    }
+    addLiteral(iLiteralStart, szLayout.size() - iLiteralStart);
+}
+
+/*********************************************************************
+void SceneFormatter::addLiteral(size_t iOffset, size_t iLength)
+Purpose:
+    Appends a literal segment.
+Parameters:
+    I size_t iOffset - Start of the text in szLayout
+    I size_t iLength - Length of the text
+Return Value:
+    None
+Notes:
+    Empty literals are dropped.
+*********************************************************************/
+void SceneFormatter::addLiteral(size_t iOffset, size_t iLength)
+{
+    if(iLength == 0) return;
+    segments.push_back(Segment{ Field::Literal, static_cast<uint32_t>(iOffset), static_cast<uint32_t>(iLength) });
+}
+
+/*********************************************************************
+void SceneFormatter::render(const CustomerProfile& profile, std::string& buffer) const
+Purpose:
+    Renders a customer scene, replacing the buffer's contents.
+Parameters:
+    I const CustomerProfile& profile - Customer to describe
+    O std::string& buffer - Receives the scene
+Return Value:
+    None
+Notes:
+    The buffer keeps its capacity, so reuse it across scenes.
+*********************************************************************/
+void SceneFormatter::render(const CustomerProfile& profile, std::string& buffer) const
+{
+    buffer.clear();
+    renderAppend(profile, buffer);
+}
+
+/*********************************************************************
+void SceneFormatter::renderAppend(const CustomerProfile& profile, std::string& buffer) const
+Purpose:
+    Renders a customer scene onto the end of a buffer.
+Parameters:
+    I const CustomerProfile& profile - Customer to describe
+    I/O std::string& buffer - Receives the scene after its current text
+Return Value:
+    None
+Notes:
+    Quantity and cost are formatted once into stack buffers and
+    copied wherever they appear. Cost is rounded to the cent and
+    written with two decimals, as the manifest shows it.
+*********************************************************************/
+void SceneFormatter::renderAppend(const CustomerProfile& profile, std::string& buffer) const
+{
+    char szQuantity[16];
+    char szCost[Credits::MAX_FORMATTED];
+    size_t iQuantityLength = static_cast<size_t>(std::to_chars(szQuantity, szQuantity + sizeof(szQuantity), profile.iQuantity).ptr - szQuantity);
+    size_t iCostLength = static_cast<size_t>(Credits::fromDouble(profile.dCost).format(szCost) - szCost);
+
+    for(const Segment& segment : segments)
+    {
+        switch(segment.field)
+        {
+            case Field::Literal: buffer.append(szLayout, segment.iOffset, segment.iLength); break;
+            case Field::Name: buffer.append(profile.szName); break;
+            case Field::Arrival: buffer.append(profile.szArrival); break;
+            case Field::Item: buffer.append(profile.szItem); break;
+            case Field::Quantity: buffer.append(szQuantity, iQuantityLength); break;
+            case Field::Cost: buffer.append(szCost, iCostLength); break;
+            case Field::Accusation: buffer.append(profile.szAccusation); break;
+            case Field::Riddle: buffer.append(profile.szRiddle); break;
+            case Field::Sprite: buffer.append(profile.szSprite); break;
+        }
+    }
+}
+
+/*********************************************************************
+SceneFormatter::Field SceneFormatter::fieldNamed(std::string_view szPlaceholder)
+Purpose:
+    Maps a placeholder name to the field it stands for.
+Parameters:
+    I std::string_view szPlaceholder - Text between the braces
+Return Value:
+    Field - The field, or Field::Literal if the name is unknown
+Notes:
+    None
+*********************************************************************/
+SceneFormatter::Field SceneFormatter::fieldNamed(std::string_view szPlaceholder)
+{
+    if(szPlaceholder == "name") return Field::Name;
+    if(szPlaceholder == "arrival") return Field::Arrival;
+    if(szPlaceholder == "item") return Field::Item;
+    if(szPlaceholder == "qty") return Field::Quantity;
+    if(szPlaceholder == "cost") return Field::Cost;
+    if(szPlaceholder == "accusation") return Field::Accusation;
+    if(szPlaceholder == "riddle") return Field::Riddle;
+    if(szPlaceholder == "sprite") return Field::Sprite;
+    return Field::Literal;
+}
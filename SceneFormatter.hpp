@@ -0,0 +1,77 @@
+/*********************************************************************
+File name: SceneFormatter.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the SceneFormatter class, which renders customer
+    scenes from a layout template and a CustomerProfile.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for SceneFormatter.
+Notes:
+    Lets scenarios have any number of customers without a hand-written
+    scene for each.
+*********************************************************************/
+
+#pragma once
+#include "CustomerProfile.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*********************************************************************
+Class Name: SceneFormatter
+Purpose:
+    Holds a scene layout with {name}, {arrival}, {item}, {qty},
+    {cost}, {accusation}, {riddle} and {sprite} placeholders and fills
+    it in from a CustomerProfile.
+Notes:
+    The layout is split into literal and field segments once, in the
+    constructor. render() then appends each segment straight into the
+    caller's buffer, so a buffer reused across scenes stops allocating
+    once it has grown to the largest scene. The quantity is written
+    with std::to_chars and the cost with Credits::format(), two
+    decimals like the manifest. An unknown placeholder is kept as
+    literal text.
+*********************************************************************/
+class SceneFormatter
+{
+    public:
+        enum class Field : uint8_t { Literal, Name, Arrival, Item, Quantity, Cost, Accusation, Riddle, Sprite };
+
+        static const std::string_view DEFAULT_LAYOUT;
+
+    private:
+        /*********************************************************************
+        Struct Name: Segment
+        Purpose:
+            One piece of the parsed layout.
+        Notes:
+            iOffset and iLength are only used by literal segments.
+        *********************************************************************/
+        struct Segment
+        {
+            Field field;          // What to write
+            uint32_t iOffset;     // Start of the literal in szLayout
+            uint32_t iLength;     // Length of the literal
+        };
+
+        std::string szLayout;           // Layout text the literals point into
+        std::vector<Segment> segments;  // Layout in rendering order
+
+        void addLiteral(size_t iOffset, size_t iLength);
+
+    public:
+        explicit SceneFormatter(std::string_view szLayoutText = DEFAULT_LAYOUT);
+
+        void render(const CustomerProfile& profile, std::string& buffer) const;
+        void renderAppend(const CustomerProfile& profile, std::string& buffer) const;
+        size_t getSegmentCount() const { return segments.size(); }
+
+        static Field fieldNamed(std::string_view szPlaceholder);
+};
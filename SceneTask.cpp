@@ -0,0 +1,156 @@
+/*********************************************************************
+File name: SceneTask.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for CountedFrame and LineChannel.
+Command Parameters:
+    N/A
+Input:
+    Lines of player input per session.
+Results:
+    Lines handed to the coroutines awaiting them.
+Notes:
+    None
+*********************************************************************/
+
+#include "SceneTask.hpp"
+#include "SessionFootprint.hpp"
+#include <atomic>
+
+namespace
+{
+    std::atomic<size_t> iLiveFrameBytes(0);   // Bytes held by live coroutine frames
+    std::atomic<size_t> iLiveFrames(0);       // Live coroutine frames
+}
+
+/*********************************************************************
+void* CountedFrame::operator new(size_t iBytes)
+Purpose:
+    Allocates a coroutine frame and counts its size.
+Parameters:
+    I size_t iBytes - Frame size chosen by the compiler
+Return Value:
+    void* - The frame
+Notes:
+    None
+*********************************************************************/
+void* CountedFrame::operator new(size_t iBytes)
+{
+    iLiveFrameBytes += iBytes;
+    iLiveFrames++;
+    return ::operator new(iBytes);
+}
+
+/*********************************************************************
+void CountedFrame::operator delete(void* pFrame, size_t iBytes)
+Purpose:
+    Frees a coroutine frame.
+Parameters:
+    I void* pFrame - The frame
+    I size_t iBytes - Frame size
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void CountedFrame::operator delete(void* pFrame, size_t iBytes)
+{
+    iLiveFrameBytes -= iBytes;
+    iLiveFrames--;
+    ::operator delete(pFrame, iBytes);
+}
+
+/*********************************************************************
+size_t CountedFrame::getFrameBytes()
+Purpose:
+    Reports the memory held by live coroutine frames.
+Parameters:
+    None
+Return Value:
+    size_t - Total frame bytes
+Notes:
+    None
+*********************************************************************/
+size_t CountedFrame::getFrameBytes()
+{
+    return iLiveFrameBytes.load();
+}
+
+/*********************************************************************
+size_t CountedFrame::getFrameCount()
+Purpose:
+    Reports how many coroutine frames are alive.
+Parameters:
+    None
+Return Value:
+    size_t - Live frames
+Notes:
+    A suspended session holds one frame per scene and prompt it is
+    nested in.
+*********************************************************************/
+size_t CountedFrame::getFrameCount()
+{
+    return iLiveFrames.load();
+}
+
+/*********************************************************************
+std::optional<std::string> LineChannel::Awaiter::await_resume()
+Purpose:
+    Hands the next line to the resumed coroutine.
+Parameters:
+    None
+Return Value:
+    std::optional<std::string> - The line, or nullopt once closed
+Notes:
+    None
+*********************************************************************/
+std::optional<std::string> LineChannel::Awaiter::await_resume()
+{
+    channel.waiting = nullptr;
+    if(channel.iInboxHead == channel.inbox.size()) return std::nullopt;
+
+    std::string szLine = std::move(channel.inbox[channel.iInboxHead++]);
+    if(channel.iInboxHead == channel.inbox.size())
+    {
+        channel.inbox.clear();
+        channel.iInboxHead = 0;
+    }
+    return szLine;
+}
+
+/*********************************************************************
+void LineChannel::push(const std::string& szLine)
+Purpose:
+    Queues a line of input.
+Parameters:
+    I const std::string& szLine - Line typed, without its line ending
+Return Value:
+    None
+Notes:
+    Lines pushed after close() are dropped.
+*********************************************************************/
+void LineChannel::push(const std::string& szLine)
+{
+    if(bClosed) return;
+    inbox.push_back(szLine);
+}
+
+/*********************************************************************
+size_t LineChannel::heapBytes() const
+Purpose:
+    Reports the heap held by queued input.
+Parameters:
+    None
+Return Value:
+    size_t - Inbox array and line bytes
+Notes:
+    None
+*********************************************************************/
+size_t LineChannel::heapBytes() const
+{
+    size_t iBytes = inbox.capacity() * sizeof(std::string);
+    for(const std::string& szLine : inbox) iBytes += SessionFootprint::heapBytes(szLine);
+    return iBytes;
+}
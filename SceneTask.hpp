@@ -0,0 +1,166 @@
+/*********************************************************************
+File name: SceneTask.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for SceneTask, the coroutine type game scenes and
+    prompts are written as, and LineChannel, the input they await.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Definitions for CountedFrame, SceneTask and LineChannel.
+Notes:
+    Requires -std=c++20.
+*********************************************************************/
+
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*********************************************************************
+Struct Name: CountedFrame
+Purpose:
+    Promise base that allocates coroutine frames through a counter,
+    so the memory held by suspended sessions can be reported.
+Notes:
+    operator new is kept out of line: once inlined, GCC sees
+    ::operator new paired with this class's operator delete and warns
+    of a mismatch.
+*********************************************************************/
+struct CountedFrame
+{
+    [[gnu::noinline]] static void* operator new(size_t iBytes);
+    static void operator delete(void* pFrame, size_t iBytes);
+
+    static size_t getFrameBytes();
+    static size_t getFrameCount();
+};
+
+/*********************************************************************
+Struct Name: SceneResult
+Purpose:
+    Holds the value a SceneTask<T> returns.
+Notes:
+    Specialized for void below.
+*********************************************************************/
+template<typename T>
+struct SceneResult
+{
+    std::optional<T> value;   // Set by co_return
+
+    void return_value(T result) { value.emplace(std::move(result)); }
+    T take() { return std::move(*value); }
+};
+
+template<>
+struct SceneResult<void>
+{
+    void return_void() {}
+    void take() {}
+};
+
+/*********************************************************************
+Class Name: SceneTask
+Purpose:
+    Coroutine for one scene or prompt, awaited by the scene or session
+    that runs it.
+Notes:
+    Starts only when awaited and hands control straight back to its
+    awaiter when it finishes, so scenes nest as deeply as plain calls
+    without growing the stack. The awaiter receives the co_return
+    value.
+*********************************************************************/
+template<typename T = void>
+class SceneTask
+{
+    public:
+        struct promise_type : CountedFrame, SceneResult<T>
+        {
+            std::coroutine_handle<> continuation;   // Coroutine awaiting this one
+
+            /*********************************************************************
+            Struct Name: FinalAwaiter
+            Purpose:
+                Resumes the awaiting coroutine once the task finishes.
+            *********************************************************************/
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> coroutine) noexcept { return coroutine.promise().continuation; }
+                void await_resume() const noexcept {}
+            };
+
+            SceneTask get_return_object() { return SceneTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void unhandled_exception() { throw; }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle;   // Owned coroutine frame
+
+    public:
+        explicit SceneTask(std::coroutine_handle<promise_type> coroutine) : handle(coroutine) {}
+        SceneTask(SceneTask&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+        SceneTask(const SceneTask&) = delete;
+        SceneTask& operator=(const SceneTask&) = delete;
+        SceneTask& operator=(SceneTask&&) = delete;
+        ~SceneTask() { if(handle) handle.destroy(); }
+
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        T await_resume() { return handle.promise().take(); }
+};
+
+/*********************************************************************
+Class Name: LineChannel
+Purpose:
+    Lines of input queued for one session, and the coroutine waiting
+    on the next of them.
+Notes:
+    The inbox is reset whenever it drains so it never grows past the
+    largest burst of lines.
+*********************************************************************/
+class LineChannel
+{
+    private:
+        std::vector<std::string> inbox;   // Lines delivered but not yet read
+        size_t iInboxHead = 0;            // Next unread line in inbox
+        bool bClosed = false;             // No more lines will arrive
+        std::coroutine_handle<> waiting;  // Coroutine suspended on next()
+
+    public:
+        /*********************************************************************
+        Struct Name: Awaiter
+        Purpose:
+            Awaitable for the next line; resumes with nullopt once the
+            channel is closed and drained.
+        *********************************************************************/
+        struct Awaiter
+        {
+            LineChannel& channel;
+
+            bool await_ready() const { return channel.iInboxHead < channel.inbox.size() || channel.bClosed; }
+            void await_suspend(std::coroutine_handle<> coroutine) { channel.waiting = coroutine; }
+            std::optional<std::string> await_resume();
+        };
+
+        Awaiter next() { return Awaiter{*this}; }
+        void push(const std::string& szLine);
+        void close() { bClosed = true; }
+        bool isClosed() const { return bClosed; }
+        bool isWaiting() const { return static_cast<bool>(waiting); }
+        void resume() { waiting.resume(); }
+        size_t heapBytes() const;
+};
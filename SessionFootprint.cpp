@@ -0,0 +1,79 @@
+/*********************************************************************
+File name: SessionFootprint.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for SessionFootprint.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Totals and a printable breakdown of session memory.
+Notes:
+    None
+*********************************************************************/
+
+#include "SessionFootprint.hpp"
+
+/*********************************************************************
+SessionFootprint& SessionFootprint::operator+=(const SessionFootprint& other)
+Purpose:
+    Adds another session's footprint to this one.
+Parameters:
+    I const SessionFootprint& other - Footprint to add
+Return Value:
+    SessionFootprint& - This footprint
+Notes:
+    Used to total a whole scheduler.
+*********************************************************************/
+SessionFootprint& SessionFootprint::operator+=(const SessionFootprint& other)
+{
+    iSessionBytes += other.iSessionBytes;
+    iFrameBytes += other.iFrameBytes;
+    iGameBytes += other.iGameBytes;
+    iStateBytes += other.iStateBytes;
+    iManifestBytes += other.iManifestBytes;
+    return *this;
+}
+
+/*********************************************************************
+void SessionFootprint::print(std::ostream& out, size_t iSessions) const
+Purpose:
+    Writes the breakdown on one line.
+Parameters:
+    I/O std::ostream& out - Destination
+    I size_t iSessions - Sessions this footprint totals; every figure
+                         is divided by it
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void SessionFootprint::print(std::ostream& out, size_t iSessions) const
+{
+    if(iSessions == 0) iSessions = 1;
+    out << total() / iSessions << " B (session " << iSessionBytes / iSessions
+        << ", frame " << iFrameBytes / iSessions
+        << ", game " << iGameBytes / iSessions
+        << ", state " << iStateBytes / iSessions
+        << ", manifest " << iManifestBytes / iSessions << ")";
+}
+
+/*********************************************************************
+size_t SessionFootprint::heapBytes(const std::string& szText)
+Purpose:
+    Heap memory behind a string.
+Parameters:
+    I const std::string& szText - String to measure
+Return Value:
+    size_t - Allocated bytes, 0 while the text fits inline
+Notes:
+    None
+*********************************************************************/
+size_t SessionFootprint::heapBytes(const std::string& szText)
+{
+    static const size_t INLINE_CHARS = std::string().capacity();
+    return szText.capacity() > INLINE_CHARS ? szText.capacity() + 1 : 0;
+}
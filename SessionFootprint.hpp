@@ -0,0 +1,48 @@
+/*********************************************************************
+File name: SessionFootprint.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for SessionFootprint, the memory held by one hosted
+    game session broken down by component.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Struct definition for SessionFootprint.
+Notes:
+    Filled in by GameManager::getFootprint() and
+    SessionScheduler::getFootprint().
+*********************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+/*********************************************************************
+Struct Name: SessionFootprint
+Purpose:
+    Bytes owned by a session, object sizes plus the heap blocks they
+    point to.
+Notes:
+    Scene text and the crew statements log are shared by every
+    session and are not counted here. Heap blocks are counted at their
+    requested size, without allocator overhead.
+*********************************************************************/
+struct SessionFootprint
+{
+    size_t iSessionBytes = 0;    // Scheduler bookkeeping and queued input
+    size_t iFrameBytes = 0;      // Coroutine frame
+    size_t iGameBytes = 0;       // GameManager object
+    size_t iStateBytes = 0;      // Heap strings held by the GameState
+    size_t iManifestBytes = 0;   // AirshipOrderList, its node pool and heap strings
+
+    size_t total() const { return iSessionBytes + iFrameBytes + iGameBytes + iStateBytes + iManifestBytes; }
+    SessionFootprint& operator+=(const SessionFootprint& other);
+    void print(std::ostream& out, size_t iSessions = 1) const;
+
+    static size_t heapBytes(const std::string& szText);
+};
@@ -0,0 +1,162 @@
+/*********************************************************************
+File name: SessionRecorder.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the SessionRecorder class.
+Command Parameters:
+    N/A
+Input:
+    Raw player input handed over by InputReader.
+Results:
+    A binary session transcript on disk.
+Notes:
+    None
+*********************************************************************/
+
+#include "SessionRecorder.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+const char SessionRecorder::MAGIC[4] = { 'A', 'S', 'R', 'S' };
+
+namespace
+{
+    /*********************************************************************
+    void appendVarint(std::string& szOut, uint64_t iValue)
+    Purpose:
+        Appends iValue as a little-endian base-128 varint.
+    *********************************************************************/
+    void appendVarint(std::string& szOut, uint64_t iValue)
+    {
+        while(iValue >= 0x80)
+        {
+            szOut.push_back(static_cast<char>((iValue & 0x7f) | 0x80));
+            iValue >>= 7;
+        }
+        szOut.push_back(static_cast<char>(iValue));
+    }
+
+    /*********************************************************************
+    bool writeAll(int iFd, const std::string& szData)
+    Purpose:
+        Writes the whole string, retrying short and interrupted writes.
+    *********************************************************************/
+    bool writeAll(int iFd, const std::string& szData)
+    {
+        const char* pData = szData.data();
+        size_t iLength = szData.size();
+        while(iLength > 0)
+        {
+            ssize_t iWritten = ::write(iFd, pData, iLength);
+            if(iWritten < 0)
+            {
+                if(errno == EINTR) continue;
+                return false;
+            }
+            pData += iWritten;
+            iLength -= static_cast<size_t>(iWritten);
+        }
+        return true;
+    }
+}
+
+/*********************************************************************
+SessionRecorder::SessionRecorder(const std::string& szPath, const SessionSetup& setup)
+Purpose:
+    Constructor that creates (or truncates) a transcript and writes
+    its header.
+Parameters:
+    I const std::string& szPath - Transcript path
+    I const SessionSetup& setup - Shift being recorded
+Return Value:
+    None (constructor)
+Notes:
+    Check isOpen() after construction.
+*********************************************************************/
+SessionRecorder::SessionRecorder(const std::string& szPath, const SessionSetup& setup) :
+    iFd(::open(szPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)), lastEvent(std::chrono::steady_clock::now())
+{
+    if(iFd < 0) return;
+
+    std::string szHeader(MAGIC, sizeof(MAGIC));
+    szHeader.push_back(static_cast<char>(VERSION));
+    appendVarint(szHeader, setup.iScenarioCustomers);
+    if(setup.iScenarioCustomers > 0)
+    {
+        appendVarint(szHeader, setup.iScenarioSeed);
+        appendVarint(szHeader, setup.iScenarioFrauds);
+    }
+    if(!writeAll(iFd, szHeader))
+    {
+        ::close(iFd);
+        iFd = -1;
+    }
+}
+
+/*********************************************************************
+SessionRecorder::~SessionRecorder()
+Purpose:
+    Destructor that closes the transcript.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    None
+*********************************************************************/
+SessionRecorder::~SessionRecorder()
+{
+    if(iFd >= 0) ::close(iFd);
+}
+
+/*********************************************************************
+bool SessionRecorder::record(const char* pData, size_t iLength)
+Purpose:
+    Records an input event stamped with the time since the last one.
+Parameters:
+    I const char* pData - Bytes the player sent
+    I size_t iLength - Number of bytes
+Return Value:
+    bool - False if the transcript is closed or the write failed
+Notes:
+    None
+*********************************************************************/
+bool SessionRecorder::record(const char* pData, size_t iLength)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    uint64_t iDelayMicros = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - lastEvent).count());
+    lastEvent = now;
+    return record(pData, iLength, iDelayMicros);
+}
+
+/*********************************************************************
+bool SessionRecorder::record(const char* pData, size_t iLength, uint64_t iDelayMicros)
+Purpose:
+    Records an input event with an explicit delay.
+Parameters:
+    I const char* pData - Bytes the player sent
+    I size_t iLength - Number of bytes
+    I uint64_t iDelayMicros - Microseconds since the previous event
+Return Value:
+    bool - False if the transcript is closed or the write failed
+Notes:
+    Used to build transcripts from scripts without waiting.
+*********************************************************************/
+bool SessionRecorder::record(const char* pData, size_t iLength, uint64_t iDelayMicros)
+{
+    if(iFd < 0) return false;
+
+    std::string szEvent;
+    szEvent.reserve(iLength + 20);
+    appendVarint(szEvent, iDelayMicros);
+    appendVarint(szEvent, iLength);
+    szEvent.append(pData, iLength);
+    if(!writeAll(iFd, szEvent)) return false;
+
+    iEventCount++;
+    return true;
+}
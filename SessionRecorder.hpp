@@ -0,0 +1,72 @@
+/*********************************************************************
+File name: SessionRecorder.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the SessionRecorder class, which saves every
+    player input of a shift so it can be replayed later.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for SessionRecorder.
+Notes:
+    Transcripts are read back by SessionReplayer.
+*********************************************************************/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*********************************************************************
+Struct Name: SessionSetup
+Purpose:
+    Which shift a transcript was recorded against.
+Notes:
+    iScenarioCustomers of 0 means the six written customers.
+*********************************************************************/
+struct SessionSetup
+{
+    uint64_t iScenarioSeed = 0;      // ScenarioGenerator seed
+    size_t iScenarioCustomers = 0;   // Generated customers, 0 for the written shift
+    size_t iScenarioFrauds = 0;      // Frauds planted in the generated shift
+};
+
+/*********************************************************************
+Class Name: SessionRecorder
+Purpose:
+    Appends timestamped input events to a compact binary transcript.
+Notes:
+    The file starts with the 4-byte magic "ASRS", a version byte and
+    the SessionSetup as varints: customer count, then seed and fraud
+    count if the count is not 0. Each event is a varint delay in microseconds since the previous
+    event, a varint length and the raw bytes the player sent. Events
+    are the chunks InputReader reads, which on a terminal is one per
+    line typed. Each event is written immediately so a transcript
+    survives the crash it is meant to reproduce.
+*********************************************************************/
+class SessionRecorder
+{
+    private:
+        int iFd;                                              // Transcript descriptor
+        std::chrono::steady_clock::time_point lastEvent;      // Time of the previous event
+        size_t iEventCount = 0;                               // Events recorded so far
+
+    public:
+        static const char MAGIC[4];
+        static const uint8_t VERSION = 2;
+
+        explicit SessionRecorder(const std::string& szPath, const SessionSetup& setup = SessionSetup());
+        ~SessionRecorder();
+        SessionRecorder(const SessionRecorder&) = delete;
+        SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+        bool record(const char* pData, size_t iLength);
+        bool record(const char* pData, size_t iLength, uint64_t iDelayMicros);
+        bool isOpen() const { return iFd >= 0; }
+        size_t getEventCount() const { return iEventCount; }
+};
@@ -0,0 +1,296 @@
+/*********************************************************************
+File name: SessionReplayer.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the SessionReplayer class.
+Command Parameters:
+    N/A
+Input:
+    Session transcripts written by SessionRecorder.
+Results:
+    Replayed shifts and their outcomes.
+Notes:
+    None
+*********************************************************************/
+
+#include "SessionReplayer.hpp"
+#include "AirshipOrderList.hpp"
+#include "DisplayManager.hpp"
+#include "GameManager.hpp"
+#include "InputReader.hpp"
+#include "ScenarioGenerator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+namespace
+{
+    /*********************************************************************
+    Class Name: DigestSink
+    Purpose:
+        Sink that hashes and counts output instead of writing it.
+    *********************************************************************/
+    class DigestSink : public OutputSink
+    {
+        private:
+            uint64_t iDigest = 14695981039346656037ull;   // FNV-1a offset basis
+            size_t iBytes = 0;                           // Bytes hashed
+
+        protected:
+            bool writeOut(const char* pData, size_t iLength) override
+            {
+                for(size_t i = 0; i < iLength; i++)
+                {
+                    iDigest ^= static_cast<unsigned char>(pData[i]);
+                    iDigest *= 1099511628211ull;
+                }
+                iBytes += iLength;
+                return true;
+            }
+
+        public:
+            ~DigestSink() override { pubsync(); }
+            uint64_t getDigest() { pubsync(); return iDigest; }
+            size_t getBytes() { pubsync(); return iBytes; }
+    };
+
+    /*********************************************************************
+    bool readVarint(const std::string& szData, size_t& iPos, uint64_t& iValue)
+    Purpose:
+        Decodes a varint written by SessionRecorder.
+    *********************************************************************/
+    bool readVarint(const std::string& szData, size_t& iPos, uint64_t& iValue)
+    {
+        iValue = 0;
+        for(int iShift = 0; iShift < 64 && iPos < szData.size(); iShift += 7)
+        {
+            unsigned char cByte = static_cast<unsigned char>(szData[iPos++]);
+            iValue |= static_cast<uint64_t>(cByte & 0x7f) << iShift;
+            if((cByte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    /*********************************************************************
+    const DisplayManager& sharedScenes()
+    Purpose:
+        Scene text shared by every replay.
+    *********************************************************************/
+    const DisplayManager& sharedScenes()
+    {
+        static const DisplayManager displayManager;
+        return displayManager;
+    }
+
+    /*********************************************************************
+    std::unique_ptr<ScenarioGenerator> scenarioFor(const SessionSetup& setup)
+    Purpose:
+        Rebuilds the generated shift a transcript was recorded against,
+        or returns nullptr for the written one.
+    *********************************************************************/
+    std::unique_ptr<ScenarioGenerator> scenarioFor(const SessionSetup& setup)
+    {
+        if(setup.iScenarioCustomers == 0) return nullptr;
+        return std::unique_ptr<ScenarioGenerator>(new ScenarioGenerator(setup.iScenarioSeed, setup.iScenarioCustomers, setup.iScenarioFrauds));
+    }
+}
+
+/*********************************************************************
+std::string SessionTranscript::toScript() const
+Purpose:
+    Joins every event back into the input the player typed.
+Parameters:
+    None
+Return Value:
+    std::string - Complete input of the shift
+Notes:
+    None
+*********************************************************************/
+std::string SessionTranscript::toScript() const
+{
+    size_t iTotal = 0;
+    for(const InputEvent& event : events) iTotal += event.szBytes.size();
+
+    std::string szScript;
+    szScript.reserve(iTotal);
+    for(const InputEvent& event : events) szScript += event.szBytes;
+    return szScript;
+}
+
+/*********************************************************************
+uint64_t SessionTranscript::getDurationMicros() const
+Purpose:
+    Returns how long the recorded shift took in real time.
+Parameters:
+    None
+Return Value:
+    uint64_t - Sum of every event delay
+Notes:
+    None
+*********************************************************************/
+uint64_t SessionTranscript::getDurationMicros() const
+{
+    uint64_t iTotal = 0;
+    for(const InputEvent& event : events) iTotal += event.iDelayMicros;
+    return iTotal;
+}
+
+/*********************************************************************
+bool SessionReplayer::load(const std::string& szPath, SessionTranscript& transcript)
+Purpose:
+    Reads a transcript from disk.
+Parameters:
+    I const std::string& szPath - Transcript path
+    O SessionTranscript& transcript - Decoded events
+Return Value:
+    bool - False if the file is missing or not a transcript
+Notes:
+    A torn final event, left by a crash mid-write, is dropped.
+    Version 1 transcripts have no setup and play the written shift.
+*********************************************************************/
+bool SessionReplayer::load(const std::string& szPath, SessionTranscript& transcript)
+{
+    transcript.setup = SessionSetup();
+    transcript.events.clear();
+
+    std::ifstream file(szPath, std::ios::binary);
+    if(!file) return false;
+    std::string szData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const size_t HEADER_BYTES = sizeof(SessionRecorder::MAGIC) + 1;
+    if(szData.size() < HEADER_BYTES || std::memcmp(szData.data(), SessionRecorder::MAGIC, sizeof(SessionRecorder::MAGIC)) != 0)
+    {
+        return false;
+    }
+    uint8_t iVersion = static_cast<uint8_t>(szData[sizeof(SessionRecorder::MAGIC)]);
+    if(iVersion != 1 && iVersion != SessionRecorder::VERSION) return false;
+
+    size_t iPos = HEADER_BYTES;
+    if(iVersion == SessionRecorder::VERSION)
+    {
+        uint64_t iCustomers = 0;
+        if(!readVarint(szData, iPos, iCustomers)) return false;
+        transcript.setup.iScenarioCustomers = static_cast<size_t>(iCustomers);
+        if(iCustomers > 0)
+        {
+            uint64_t iFrauds = 0;
+            if(!readVarint(szData, iPos, transcript.setup.iScenarioSeed) || !readVarint(szData, iPos, iFrauds)) return false;
+            transcript.setup.iScenarioFrauds = static_cast<size_t>(iFrauds);
+        }
+    }
+    while(iPos < szData.size())
+    {
+        InputEvent event;
+        uint64_t iLength = 0;
+        if(!readVarint(szData, iPos, event.iDelayMicros) || !readVarint(szData, iPos, iLength) ||
+           iLength > szData.size() - iPos)
+        {
+            break;
+        }
+        event.szBytes.assign(szData, iPos, static_cast<size_t>(iLength));
+        iPos += static_cast<size_t>(iLength);
+        transcript.events.push_back(std::move(event));
+    }
+    return true;
+}
+
+/*********************************************************************
+bool SessionReplayer::replay(const SessionTranscript& transcript, OutputSink& output)
+Purpose:
+    Plays a whole shift from a transcript on an empty manifest.
+Parameters:
+    I const SessionTranscript& transcript - Recorded input
+    I/O OutputSink& output - Destination of the game output
+Return Value:
+    bool - True if the shift ended in victory
+Notes:
+    A generated shift is rebuilt from the transcript's setup.
+*********************************************************************/
+bool SessionReplayer::replay(const SessionTranscript& transcript, OutputSink& output)
+{
+    AirshipOrderList airshipOrderList;
+    InputReader input(transcript.toScript());
+    std::unique_ptr<ScenarioGenerator> scenario = scenarioFor(transcript.setup);
+    GameManager gameManager(airshipOrderList, input, output);
+    gameManager.setScenario(scenario.get());
+    gameManager.runShift(sharedScenes());
+    return gameManager.getIsGuessCorrect();
+}
+
+/*********************************************************************
+ReplayResult SessionReplayer::replayFile(const std::string& szPath)
+Purpose:
+    Loads and replays one transcript, hashing its output.
+Parameters:
+    I const std::string& szPath - Transcript path
+Return Value:
+    ReplayResult - Outcome of the replay
+Notes:
+    bLoaded is false and nothing else is set if loading failed.
+*********************************************************************/
+ReplayResult SessionReplayer::replayFile(const std::string& szPath)
+{
+    ReplayResult result;
+    result.szPath = szPath;
+
+    SessionTranscript transcript;
+    if(!load(szPath, transcript)) return result;
+    result.bLoaded = true;
+
+    AirshipOrderList airshipOrderList;
+    InputReader input(transcript.toScript());
+    std::unique_ptr<ScenarioGenerator> scenario = scenarioFor(transcript.setup);
+    DigestSink output;
+    {
+        GameManager gameManager(airshipOrderList, input, output);
+        gameManager.setScenario(scenario.get());
+        gameManager.runShift(sharedScenes());
+        result.bGuessCorrect = gameManager.getIsGuessCorrect();
+    }
+    result.iDeliveries = airshipOrderList.size();
+    result.iOutputBytes = output.getBytes();
+    result.iOutputDigest = output.getDigest();
+    return result;
+}
+
+/*********************************************************************
+std::vector<ReplayResult> SessionReplayer::replayAll(const std::vector<std::string>& paths, unsigned iThreads)
+Purpose:
+    Replays many transcripts in parallel.
+Parameters:
+    I const std::vector<std::string>& paths - Transcripts to replay
+    I unsigned iThreads - Worker count, 0 for one per core
+Return Value:
+    std::vector<ReplayResult> - One result per path, in order
+Notes:
+    Workers claim the next transcript from a shared counter, so long
+    sessions do not hold up the rest of a worker's share.
+*********************************************************************/
+std::vector<ReplayResult> SessionReplayer::replayAll(const std::vector<std::string>& paths, unsigned iThreads)
+{
+    std::vector<ReplayResult> results(paths.size());
+    if(iThreads == 0) iThreads = std::max(1u, std::thread::hardware_concurrency());
+    iThreads = static_cast<unsigned>(std::min<size_t>(iThreads, std::max<size_t>(paths.size(), 1)));
+
+    sharedScenes();
+    std::atomic<size_t> iNext(0);
+    auto worker = [&]()
+    {
+        for(size_t i = iNext.fetch_add(1); i < paths.size(); i = iNext.fetch_add(1))
+        {
+            results[i] = replayFile(paths[i]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned i = 1; i < iThreads; i++) workers.emplace_back(worker);
+    worker();
+    for(std::thread& thread : workers) thread.join();
+    return results;
+}
@@ -0,0 +1,91 @@
+/*********************************************************************
+File name: SessionReplayer.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the SessionReplayer class, which plays recorded
+    session transcripts back through GameManager.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for SessionReplayer and its transcript types.
+Notes:
+    Transcripts are written by SessionRecorder.
+*********************************************************************/
+
+#pragma once
+#include "OutputSink.hpp"
+#include "SessionRecorder.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*********************************************************************
+Struct Name: InputEvent
+Purpose:
+    One recorded chunk of player input.
+Notes:
+    None
+*********************************************************************/
+struct InputEvent
+{
+    uint64_t iDelayMicros = 0;   // Time since the previous event
+    std::string szBytes;         // Raw bytes the player sent
+};
+
+/*********************************************************************
+Struct Name: SessionTranscript
+Purpose:
+    Every input event of one recorded shift.
+Notes:
+    None
+*********************************************************************/
+struct SessionTranscript
+{
+    SessionSetup setup;               // Shift the input was typed against
+    std::vector<InputEvent> events;   // Events in the order they were read
+
+    std::string toScript() const;
+    uint64_t getDurationMicros() const;
+};
+
+/*********************************************************************
+Struct Name: ReplayResult
+Purpose:
+    Outcome of replaying one transcript.
+Notes:
+    iOutputDigest is an FNV-1a hash of everything the game printed,
+    so two builds can be compared session by session.
+*********************************************************************/
+struct ReplayResult
+{
+    std::string szPath;           // Transcript that was replayed
+    bool bLoaded = false;         // Transcript was read successfully
+    bool bGuessCorrect = false;   // Shift ended in victory
+    size_t iDeliveries = 0;       // Deliveries left on the manifest
+    size_t iOutputBytes = 0;      // Bytes of game output
+    uint64_t iOutputDigest = 0;   // Hash of the game output
+};
+
+/*********************************************************************
+Class Name: SessionReplayer
+Purpose:
+    Loads transcripts and replays them at full speed, alone or fanned
+    out across worker threads.
+Notes:
+    Recorded delays are kept in the transcript but not waited on.
+    Each replay builds its own manifest, input, output and generated
+    scenario, so replays share nothing but the read-only scene text.
+*********************************************************************/
+class SessionReplayer
+{
+    public:
+        static bool load(const std::string& szPath, SessionTranscript& transcript);
+        static bool replay(const SessionTranscript& transcript, OutputSink& output);
+        static ReplayResult replayFile(const std::string& szPath);
+        static std::vector<ReplayResult> replayAll(const std::vector<std::string>& paths, unsigned iThreads = 0);
+};
@@ -0,0 +1,274 @@
+/*********************************************************************
+File name: SessionScheduler.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the SessionScheduler class and the
+    SessionTask coroutine type.
+Command Parameters:
+    N/A
+Input:
+    Lines of player input per session.
+Results:
+    Game output written to each session's sink.
+Notes:
+    None
+*********************************************************************/
+
+#include "SessionScheduler.hpp"
+
+/*********************************************************************
+SessionTask& SessionTask::operator=(SessionTask&& other)
+Purpose:
+    Takes over another task's frame, destroying the current one.
+Parameters:
+    I/O SessionTask&& other - Task to take over
+Return Value:
+    SessionTask& - This task
+Notes:
+    None
+*********************************************************************/
+SessionTask& SessionTask::operator=(SessionTask&& other) noexcept
+{
+    if(this != &other)
+    {
+        if(handle) handle.destroy();
+        handle = other.handle;
+        other.handle = nullptr;
+    }
+    return *this;
+}
+
+/*********************************************************************
+SessionTask::~SessionTask()
+Purpose:
+    Destroys the coroutine frame, suspended or finished.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    None
+*********************************************************************/
+SessionTask::~SessionTask()
+{
+    if(handle) handle.destroy();
+}
+
+/*********************************************************************
+SessionTask SessionScheduler::runSession(Session& session, const DisplayManager& scenes, size_t iFirstCustomer)
+Purpose:
+    The coroutine behind every session: plays the shift on the
+    session's input.
+Parameters:
+    I/O Session& session - Session being played
+    I const DisplayManager& scenes - Scene text
+    I size_t iFirstCustomer - Customers before this one are skipped
+Return Value:
+    SessionTask - Handle to the coroutine
+Notes:
+    Runs to the first prompt before open() returns.
+*********************************************************************/
+SessionTask SessionScheduler::runSession(Session& session, const DisplayManager& scenes, size_t iFirstCustomer)
+{
+    co_await session.gameManager.playShift(session.input, scenes, iFirstCustomer);
+}
+
+/*********************************************************************
+void SessionScheduler::markReady(size_t iId)
+Purpose:
+    Queues a suspended session for the next runReady().
+Parameters:
+    I size_t iId - Session id
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void SessionScheduler::markReady(size_t iId)
+{
+    Session& session = *sessions[iId];
+    if(session.bQueued || !session.input.isWaiting()) return;
+    session.bQueued = true;
+    readyIds.push_back(iId);
+}
+
+/*********************************************************************
+size_t SessionScheduler::open(OutputSink& output, size_t iFirstCustomer)
+Purpose:
+    Starts a new session and shows its first screen.
+Parameters:
+    I/O OutputSink& output - Destination of the session's output
+    I size_t iFirstCustomer - Customers before this one are skipped
+Return Value:
+    size_t - Session id
+Notes:
+    Ids of released sessions are reused. With a tracer set, the
+    session's spans go on the track numbered by its id.
+*********************************************************************/
+size_t SessionScheduler::open(OutputSink& output, size_t iFirstCustomer)
+{
+    size_t iId;
+    if(!freeIds.empty())
+    {
+        iId = freeIds.back();
+        freeIds.pop_back();
+    }
+    else
+    {
+        iId = sessions.size();
+        sessions.emplace_back();
+    }
+
+    sessions[iId].reset(new Session(output));
+    sessions[iId]->gameManager.setTracer(pTracer, static_cast<uint32_t>(iId));
+    iLive++;
+    sessions[iId]->task = runSession(*sessions[iId], scenes, iFirstCustomer);
+    return iId;
+}
+
+/*********************************************************************
+void SessionScheduler::deliver(size_t iId, const std::string& szLine)
+Purpose:
+    Queues a line of input for a session.
+Parameters:
+    I size_t iId - Session id
+    I const std::string& szLine - Line typed, without its line ending
+Return Value:
+    None
+Notes:
+    The session runs on the next runReady().
+*********************************************************************/
+void SessionScheduler::deliver(size_t iId, const std::string& szLine)
+{
+    sessions[iId]->input.push(szLine);
+    markReady(iId);
+}
+
+/*********************************************************************
+void SessionScheduler::closeInput(size_t iId)
+Purpose:
+    Tells a session no more input is coming.
+Parameters:
+    I size_t iId - Session id
+Return Value:
+    None
+Notes:
+    The session plays out to its ending on the next runReady().
+*********************************************************************/
+void SessionScheduler::closeInput(size_t iId)
+{
+    sessions[iId]->input.close();
+    markReady(iId);
+}
+
+/*********************************************************************
+size_t SessionScheduler::runReady()
+Purpose:
+    Resumes every session that has input waiting.
+Parameters:
+    None
+Return Value:
+    size_t - Number of sessions resumed
+Notes:
+    Each session runs until it has used up its input and suspends
+    again, or its shift ends.
+*********************************************************************/
+size_t SessionScheduler::runReady()
+{
+    std::vector<size_t> batch;
+    batch.swap(readyIds);
+    size_t iResumed = 0;
+    for(size_t iId : batch)
+    {
+        Session* pSession = sessions[iId].get();
+        if(pSession == nullptr || !pSession->bQueued) continue;
+        pSession->bQueued = false;
+        if(pSession->input.isWaiting())
+        {
+            pSession->input.resume();
+            iResumed++;
+        }
+    }
+    return iResumed;
+}
+
+/*********************************************************************
+bool SessionScheduler::isFinished(size_t iId) const
+Purpose:
+    Checks whether a session's shift has ended.
+Parameters:
+    I size_t iId - Session id
+Return Value:
+    bool - True once the ending scene has been shown
+Notes:
+    None
+*********************************************************************/
+bool SessionScheduler::isFinished(size_t iId) const
+{
+    return sessions[iId]->task.done();
+}
+
+/*********************************************************************
+void SessionScheduler::release(size_t iId)
+Purpose:
+    Destroys a session, finished or not.
+Parameters:
+    I size_t iId - Session id
+Return Value:
+    None
+Notes:
+    A queued session is skipped by runReady() once released, even if
+    its id has been reused.
+*********************************************************************/
+void SessionScheduler::release(size_t iId)
+{
+    if(sessions[iId] == nullptr) return;
+    sessions[iId].reset();
+    freeIds.push_back(iId);
+    iLive--;
+}
+
+/*********************************************************************
+SessionFootprint SessionScheduler::getFootprint(size_t iId) const
+Purpose:
+    Reports the memory held by one session.
+Parameters:
+    I size_t iId - Session id
+Return Value:
+    SessionFootprint - Breakdown by component
+Notes:
+    Frames are counted process-wide, so the frame bytes are the
+    average over live sessions.
+*********************************************************************/
+SessionFootprint SessionScheduler::getFootprint(size_t iId) const
+{
+    const Session& session = *sessions[iId];
+    SessionFootprint footprint = session.gameManager.getFootprint();
+    footprint.iSessionBytes = sizeof(Session) - sizeof(GameManager) - sizeof(AirshipOrderList) +
+                              sizeof(std::unique_ptr<Session>) + session.input.heapBytes();
+    if(!session.task.done() && iLive > 0) footprint.iFrameBytes = CountedFrame::getFrameBytes() / iLive;
+    return footprint;
+}
+
+/*********************************************************************
+SessionFootprint SessionScheduler::getFootprint() const
+Purpose:
+    Reports the memory held by every live session together.
+Parameters:
+    None
+Return Value:
+    SessionFootprint - Sum over live sessions
+Notes:
+    Divide by size() for the average session.
+*********************************************************************/
+SessionFootprint SessionScheduler::getFootprint() const
+{
+    SessionFootprint footprint;
+    for(size_t iId = 0; iId < sessions.size(); iId++)
+    {
+        if(sessions[iId] != nullptr) footprint += getFootprint(iId);
+    }
+    return footprint;
+}
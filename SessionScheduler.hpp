@@ -0,0 +1,125 @@
+/*********************************************************************
+File name: SessionScheduler.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the SessionScheduler class and SessionTask, the
+    C++20 coroutine driver for game sessions.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definitions for SessionTask and SessionScheduler.
+Notes:
+    Requires -std=c++20.
+*********************************************************************/
+
+#pragma once
+#include "AirshipOrderList.hpp"
+#include "DisplayManager.hpp"
+#include "GameManager.hpp"
+#include "OutputSink.hpp"
+#include "SceneTask.hpp"
+#include "SessionFootprint.hpp"
+#include "TraceRecorder.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*********************************************************************
+Class Name: SessionTask
+Purpose:
+    Coroutine handle that owns a session's outermost frame.
+Notes:
+    Runs eagerly to its first co_await and stays suspended at the end
+    so done() can be checked. Frames are allocated through
+    CountedFrame so their total size can be reported.
+*********************************************************************/
+class SessionTask
+{
+    public:
+        struct promise_type : CountedFrame
+        {
+            SessionTask get_return_object() { return SessionTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { throw; }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle;   // Owned coroutine frame
+
+    public:
+        SessionTask() = default;
+        explicit SessionTask(std::coroutine_handle<promise_type> coroutine) : handle(coroutine) {}
+        SessionTask(SessionTask&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+        SessionTask& operator=(SessionTask&& other) noexcept;
+        SessionTask(const SessionTask&) = delete;
+        SessionTask& operator=(const SessionTask&) = delete;
+        ~SessionTask();
+
+        bool done() const { return !handle || handle.done(); }
+};
+
+/*********************************************************************
+Class Name: SessionScheduler
+Purpose:
+    Hosts many game sessions on one thread. Each session runs
+    GameManager::playShift(), whose scenes and prompts co_await the
+    session's next line of input.
+Notes:
+    deliver() only queues a line; runReady() resumes every session
+    with input waiting, so an event loop can read from all of its
+    sockets first and then run the game once. Sessions never block,
+    and a suspended session costs its Session object plus the frames
+    of the scene and prompt it is waiting in.
+*********************************************************************/
+class SessionScheduler
+{
+    private:
+        struct Session
+        {
+            AirshipOrderList airshipOrderList;        // Session's manifest
+            GameManager gameManager;                  // Session's game
+            LineChannel input;                        // Lines delivered but not yet read
+            bool bQueued = false;                     // Already on the ready list
+            SessionTask task;                         // Coroutine driving this session
+
+            explicit Session(OutputSink& output) : gameManager(airshipOrderList, output) {}
+        };
+
+        const DisplayManager& scenes;                         // Scene text shared by every session
+        std::vector<std::unique_ptr<Session>> sessions;       // Sessions by id, nullptr once released
+        std::vector<size_t> freeIds;                          // Released ids to reuse
+        std::vector<size_t> readyIds;                         // Sessions with input to process
+        size_t iLive = 0;                                     // Sessions not yet released
+        TraceRecorder* pTracer = nullptr;                     // Span recorder given to new sessions
+
+        static SessionTask runSession(Session& session, const DisplayManager& scenes, size_t iFirstCustomer);
+        void markReady(size_t iId);
+
+    public:
+        explicit SessionScheduler(const DisplayManager& displayManager) : scenes(displayManager) {}
+        SessionScheduler(const SessionScheduler&) = delete;
+        SessionScheduler& operator=(const SessionScheduler&) = delete;
+
+        size_t open(OutputSink& output, size_t iFirstCustomer = 0);
+        void deliver(size_t iId, const std::string& szLine);
+        void closeInput(size_t iId);
+        size_t runReady();
+        bool isFinished(size_t iId) const;
+        GameManager& getGame(size_t iId) { return sessions[iId]->gameManager; }
+        void release(size_t iId);
+        size_t size() const { return iLive; }
+        void setTracer(TraceRecorder* pTraceRecorder) { pTracer = pTraceRecorder; }
+        SessionFootprint getFootprint(size_t iId) const;
+        SessionFootprint getFootprint() const;
+        size_t getSharedBytes() const { return scenes.footprintBytes(); }
+
+        static size_t sessionBytes() { return sizeof(Session); }
+};
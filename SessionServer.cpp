@@ -0,0 +1,434 @@
+/*********************************************************************
+File name: SessionServer.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the SessionServer class.
+Command Parameters:
+    N/A
+Input:
+    Lines of player input from each connected terminal.
+Results:
+    Game output sent back to each terminal.
+Notes:
+    None
+*********************************************************************/
+
+#include "SessionServer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*********************************************************************
+SessionServer::SessionServer(const DisplayManager& displayManager)
+Purpose:
+    Constructor that creates the event loop.
+Parameters:
+    I const DisplayManager& displayManager - Scene text for every session
+Return Value:
+    None (constructor)
+Notes:
+    Call listenUnix() or listenTcp() before run().
+*********************************************************************/
+SessionServer::SessionServer(const DisplayManager& displayManager) : scheduler(displayManager)
+{
+    iEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    iWakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = iWakeFd;
+    ::epoll_ctl(iEpollFd, EPOLL_CTL_ADD, iWakeFd, &event);
+}
+
+/*********************************************************************
+SessionServer::~SessionServer()
+Purpose:
+    Destructor that closes every connection and socket.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    Removes the UNIX socket file if one was created.
+*********************************************************************/
+SessionServer::~SessionServer()
+{
+    while(!connections.empty()) closeConnection(connections.begin()->first);
+    if(iListenFd >= 0) ::close(iListenFd);
+    if(iWakeFd >= 0) ::close(iWakeFd);
+    if(iEpollFd >= 0) ::close(iEpollFd);
+    if(!szUnixPath.empty()) ::unlink(szUnixPath.c_str());
+}
+
+/*********************************************************************
+bool SessionServer::startListening(int iFd)
+Purpose:
+    Puts a bound socket into listening mode and registers it.
+Parameters:
+    I int iFd - Bound socket
+Return Value:
+    bool - False if listen() failed
+Notes:
+    Takes ownership of iFd.
+*********************************************************************/
+bool SessionServer::startListening(int iFd)
+{
+    if(::listen(iFd, SOMAXCONN) != 0)
+    {
+        ::close(iFd);
+        return false;
+    }
+    iListenFd = iFd;
+
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLET;
+    event.data.fd = iListenFd;
+    return ::epoll_ctl(iEpollFd, EPOLL_CTL_ADD, iListenFd, &event) == 0;
+}
+
+/*********************************************************************
+bool SessionServer::listenUnix(const std::string& szPath)
+Purpose:
+    Listens on a UNIX domain socket.
+Parameters:
+    I const std::string& szPath - Socket file path
+Return Value:
+    bool - False if the socket could not be created
+Notes:
+    An existing file at szPath is replaced.
+*********************************************************************/
+bool SessionServer::listenUnix(const std::string& szPath)
+{
+    sockaddr_un address{};
+    if(szPath.size() >= sizeof(address.sun_path)) return false;
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, szPath.c_str(), szPath.size() + 1);
+
+    int iFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(iFd < 0) return false;
+    ::unlink(szPath.c_str());
+    if(::bind(iFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(iFd);
+        return false;
+    }
+    szUnixPath = szPath;
+    return startListening(iFd);
+}
+
+/*********************************************************************
+bool SessionServer::listenTcp(uint16_t iPort)
+Purpose:
+    Listens on a TCP port on the loopback interface.
+Parameters:
+    I uint16_t iPort - Port number
+Return Value:
+    bool - False if the socket could not be created
+Notes:
+    None
+*********************************************************************/
+bool SessionServer::listenTcp(uint16_t iPort)
+{
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(iPort);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    int iFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(iFd < 0) return false;
+    int iReuse = 1;
+    ::setsockopt(iFd, SOL_SOCKET, SO_REUSEADDR, &iReuse, sizeof(iReuse));
+    if(::bind(iFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(iFd);
+        return false;
+    }
+    return startListening(iFd);
+}
+
+/*********************************************************************
+void SessionServer::run()
+Purpose:
+    Serves connections until stop() is called.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    A connection whose output has drained below OUTPUT_HIGH_WATER is
+    read again straight away and flushed on the next pass, which then
+    polls without blocking.
+*********************************************************************/
+void SessionServer::run()
+{
+    const int MAX_EVENTS = 256;
+    epoll_event events[MAX_EVENTS];
+
+    while(!bStopping.load())
+    {
+        int iReady = ::epoll_wait(iEpollFd, events, MAX_EVENTS, touchedFds.empty() ? -1 : 0);
+        if(iReady < 0)
+        {
+            if(errno == EINTR) continue;
+            break;
+        }
+
+        for(int i = 0; i < iReady; i++)
+        {
+            int iFd = events[i].data.fd;
+            if(iFd == iWakeFd)
+            {
+                uint64_t iCount;
+                while(::read(iWakeFd, &iCount, sizeof(iCount)) > 0) {}
+                continue;
+            }
+            if(iFd == iListenFd)
+            {
+                acceptConnections();
+                continue;
+            }
+
+            auto found = connections.find(iFd);
+            if(found == connections.end()) continue;
+            if(events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) readConnection(*found->second);
+            touchedFds.push_back(iFd);
+        }
+
+        scheduler.runReady();
+
+        std::vector<int> flushFds;
+        flushFds.swap(touchedFds);
+        for(int iFd : flushFds)
+        {
+            auto found = connections.find(iFd);
+            if(found == connections.end()) continue;
+            Connection& connection = *found->second;
+
+            bool bWasBackedUp = isBackedUp(connection);
+            bool bSent = writeConnection(connection);
+            if(bWasBackedUp && !isBackedUp(connection) && !connection.bBroken)
+            {
+                readConnection(connection);
+                touchedFds.push_back(iFd);
+                continue;
+            }
+            if(connection.bBroken)
+            {
+                closeConnection(iFd);
+            }
+            else if(bSent && scheduler.isFinished(connection.iSessionId))
+            {
+                iCompleted++;
+                closeConnection(iFd);
+            }
+        }
+    }
+}
+
+/*********************************************************************
+void SessionServer::stop()
+Purpose:
+    Asks run() to return.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    Safe to call from another thread or a signal handler.
+*********************************************************************/
+void SessionServer::stop()
+{
+    bStopping.store(true);
+    uint64_t iOne = 1;
+    ssize_t iIgnored = ::write(iWakeFd, &iOne, sizeof(iOne));
+    (void)iIgnored;
+}
+
+/*********************************************************************
+void SessionServer::acceptConnections()
+Purpose:
+    Accepts every pending connection and opens a session for each.
+Parameters:
+    None
+Return Value:
+    None
+Notes:
+    The opening screen is queued for sending right away.
+*********************************************************************/
+void SessionServer::acceptConnections()
+{
+    while(true)
+    {
+        int iFd = ::accept4(iListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if(iFd < 0)
+        {
+            if(errno == EINTR || errno == ECONNABORTED) continue;
+            return;
+        }
+        int iNoDelay = 1;
+        ::setsockopt(iFd, IPPROTO_TCP, TCP_NODELAY, &iNoDelay, sizeof(iNoDelay));
+
+        std::unique_ptr<Connection> connection(new Connection(iFd));
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.fd = iFd;
+        if(::epoll_ctl(iEpollFd, EPOLL_CTL_ADD, iFd, &event) != 0)
+        {
+            ::close(iFd);
+            continue;
+        }
+
+        connection->iSessionId = scheduler.open(connection->sink);
+        connections[iFd] = std::move(connection);
+        touchedFds.push_back(iFd);
+        iAccepted++;
+    }
+}
+
+/*********************************************************************
+void SessionServer::readConnection(Connection& connection)
+Purpose:
+    Reads everything a client has sent and queues each complete line.
+Parameters:
+    I/O Connection& connection - Connection to read
+Return Value:
+    None
+Notes:
+    Reads until EAGAIN, as edge-triggered epoll requires, or until
+    the connection is backed up; run() calls this again once its
+    output drains, since no new edge may arrive. End of stream closes
+    the session's input after its last line has been played, which
+    plays the shift out; its output is still sent to a half-closed
+    client.
+*********************************************************************/
+void SessionServer::readConnection(Connection& connection)
+{
+    char buffer[16 * 1024];
+    deliverLines(connection);
+    while(!connection.bInputEnded && !isBackedUp(connection))
+    {
+        ssize_t iRead = ::read(connection.iFd, buffer, sizeof(buffer));
+        if(iRead < 0)
+        {
+            if(errno == EINTR) continue;
+            if(errno == EAGAIN || errno == EWOULDBLOCK) break;
+            connection.bBroken = true;
+            return;
+        }
+        if(iRead == 0)
+        {
+            connection.bInputEnded = true;
+            break;
+        }
+
+        connection.szInput.append(buffer, static_cast<size_t>(iRead));
+        deliverLines(connection);
+        if(connection.szInput.size() > MAX_LINE_BYTES && connection.szInput.find('\n') == std::string::npos)
+        {
+            connection.bBroken = true;
+            return;
+        }
+    }
+
+    if(connection.bInputEnded && !connection.bInputClosed && connection.szInput.find('\n') == std::string::npos)
+    {
+        connection.bInputClosed = true;
+        scheduler.closeInput(connection.iSessionId);
+    }
+}
+
+/*********************************************************************
+void SessionServer::deliverLines(Connection& connection)
+Purpose:
+    Plays the complete lines received so far, one at a time, until
+    the connection is backed up.
+Parameters:
+    I/O Connection& connection - Connection whose lines to play
+Return Value:
+    None
+Notes:
+    Each line is run before the next is delivered, so the output it
+    produces counts towards OUTPUT_HIGH_WATER straight away. Lines
+    not played stay in szInput.
+*********************************************************************/
+void SessionServer::deliverLines(Connection& connection)
+{
+    size_t iLineStart = 0;
+    size_t iNewline;
+    while(!isBackedUp(connection) && (iNewline = connection.szInput.find('\n', iLineStart)) != std::string::npos)
+    {
+        size_t iLineEnd = (iNewline > iLineStart && connection.szInput[iNewline - 1] == '\r') ? iNewline - 1 : iNewline;
+        scheduler.deliver(connection.iSessionId, connection.szInput.substr(iLineStart, iLineEnd - iLineStart));
+        scheduler.runReady();
+        iLineStart = iNewline + 1;
+    }
+    connection.szInput.erase(0, iLineStart);
+}
+
+/*********************************************************************
+bool SessionServer::writeConnection(Connection& connection)
+Purpose:
+    Sends as much pending output as the socket will take.
+Parameters:
+    I/O Connection& connection - Connection to write
+Return Value:
+    bool - True once nothing is left to send
+Notes:
+    Whatever is left is sent on the next EPOLLOUT. Once a high-water
+    mark's worth has been sent it is dropped from the front of
+    szOutput, so a slow client never holds more than that twice over.
+*********************************************************************/
+bool SessionServer::writeConnection(Connection& connection)
+{
+    while(connection.iOutputSent < connection.szOutput.size())
+    {
+        ssize_t iWritten = ::send(connection.iFd, connection.szOutput.data() + connection.iOutputSent,
+                                  connection.szOutput.size() - connection.iOutputSent, MSG_NOSIGNAL);
+        if(iWritten < 0)
+        {
+            if(errno == EINTR) continue;
+            if(errno != EAGAIN && errno != EWOULDBLOCK) connection.bBroken = true;
+            if(connection.iOutputSent >= OUTPUT_HIGH_WATER)
+            {
+                connection.szOutput.erase(0, connection.iOutputSent);
+                connection.iOutputSent = 0;
+            }
+            return false;
+        }
+        connection.iOutputSent += static_cast<size_t>(iWritten);
+    }
+    connection.szOutput.clear();
+    connection.iOutputSent = 0;
+    return true;
+}
+
+/*********************************************************************
+void SessionServer::closeConnection(int iFd)
+Purpose:
+    Ends a connection and its session.
+Parameters:
+    I int iFd - Connection socket
+Return Value:
+    None
+Notes:
+    None
+*********************************************************************/
+void SessionServer::closeConnection(int iFd)
+{
+    auto found = connections.find(iFd);
+    if(found == connections.end()) return;
+
+    scheduler.release(found->second->iSessionId);
+    ::epoll_ctl(iEpollFd, EPOLL_CTL_DEL, iFd, nullptr);
+    ::close(iFd);
+    connections.erase(found);
+}
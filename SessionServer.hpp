@@ -0,0 +1,120 @@
+/*********************************************************************
+File name: SessionServer.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the SessionServer class, which hosts game
+    sessions for dock terminals over a local socket.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for SessionServer.
+Notes:
+    Linux only (epoll, eventfd).
+*********************************************************************/
+
+#pragma once
+#include "DisplayManager.hpp"
+#include "OutputSink.hpp"
+#include "SessionScheduler.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*********************************************************************
+Class Name: SessionServer
+Purpose:
+    Accepts connections on a UNIX or TCP socket and plays one game
+    session per connection, one line of input per step.
+Notes:
+    One thread drives every connection with edge-triggered epoll:
+    each wakeup reads every socket until EAGAIN, queues the complete
+    lines with the SessionScheduler, runs the ready sessions once and
+    then writes each connection's pending output until EAGAIN. Output
+    that does not fit in the socket is kept per connection and sent
+    when epoll reports it writable. While a connection holds more than
+    OUTPUT_HIGH_WATER unsent bytes its lines are neither read nor
+    played, so a client that sends without reading cannot grow the
+    server's memory; it resumes once the output drains. A connection
+    is closed once its shift has ended and its output has been sent.
+*********************************************************************/
+class SessionServer
+{
+    private:
+        /*********************************************************************
+        Class Name: ConnectionSink
+        Purpose:
+            Sink that appends a session's output to its connection's
+            send buffer.
+        *********************************************************************/
+        class ConnectionSink : public OutputSink
+        {
+            private:
+                std::string& szPending;   // Connection's unsent output
+
+            protected:
+                bool writeOut(const char* pData, size_t iLength) override { szPending.append(pData, iLength); return true; }
+
+            public:
+                explicit ConnectionSink(std::string& szOutput) : OutputSink(0), szPending(szOutput) {}
+        };
+
+        struct Connection
+        {
+            int iFd;                         // Connected socket
+            size_t iSessionId = 0;           // Session in the scheduler
+            std::string szInput;             // Bytes received after the last full line
+            std::string szOutput;            // Output not yet sent
+            size_t iOutputSent = 0;          // Bytes of szOutput already sent
+            bool bInputEnded = false;        // Client stopped sending
+            bool bInputClosed = false;       // Session told that no more lines are coming
+            bool bBroken = false;            // Socket failed or client misbehaved
+            ConnectionSink sink;             // Session output lands in szOutput
+
+            explicit Connection(int iSocket) : iFd(iSocket), sink(szOutput) {}
+        };
+
+        static const size_t MAX_LINE_BYTES = 64 * 1024;       // Longest line before a client is dropped
+        static const size_t OUTPUT_HIGH_WATER = 256 * 1024;   // Unsent bytes that pause a connection's input
+
+        SessionScheduler scheduler;                                   // Runs every session
+        int iEpollFd = -1;                                            // Event loop
+        int iListenFd = -1;                                           // Listening socket
+        int iWakeFd = -1;                                             // eventfd poked by stop()
+        std::string szUnixPath;                                       // Socket file to unlink on exit
+        std::unordered_map<int, std::unique_ptr<Connection>> connections;   // Open connections by fd
+        std::vector<int> touchedFds;                                  // Connections to flush this pass
+        std::atomic<bool> bStopping{false};                           // Set by stop()
+        size_t iAccepted = 0;                                         // Connections accepted
+        size_t iCompleted = 0;                                        // Shifts played to the end
+
+        bool startListening(int iFd);
+        void acceptConnections();
+        void readConnection(Connection& connection);
+        void deliverLines(Connection& connection);
+        bool writeConnection(Connection& connection);
+        static bool isBackedUp(const Connection& connection) { return connection.szOutput.size() - connection.iOutputSent >= OUTPUT_HIGH_WATER; }
+        void closeConnection(int iFd);
+
+    public:
+        explicit SessionServer(const DisplayManager& displayManager);
+        ~SessionServer();
+        SessionServer(const SessionServer&) = delete;
+        SessionServer& operator=(const SessionServer&) = delete;
+
+        bool listenUnix(const std::string& szPath);
+        bool listenTcp(uint16_t iPort);
+        void run();
+        void stop();
+
+        size_t getAcceptedCount() const { return iAccepted; }
+        size_t getCompletedCount() const { return iCompleted; }
+        void setTracer(TraceRecorder* pTracer) { scheduler.setTracer(pTracer); }
+};
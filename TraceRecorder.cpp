@@ -0,0 +1,140 @@
+/*********************************************************************
+File name: TraceRecorder.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the TraceRecorder class.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Chrome trace JSON and a per-category summary of recorded spans.
+Notes:
+    None
+*********************************************************************/
+
+#include "TraceRecorder.hpp"
+#include <iomanip>
+#include <map>
+#include <set>
+#include <string>
+
+namespace
+{
+    /*********************************************************************
+    void writeMicros(std::ostream& out, uint64_t iNs)
+    Purpose:
+        Writes nanoseconds as microseconds with three decimals, the
+        unit Chrome trace timestamps use.
+    *********************************************************************/
+    void writeMicros(std::ostream& out, uint64_t iNs)
+    {
+        out << iNs / 1000 << "." << std::setw(3) << std::setfill('0') << iNs % 1000 << std::setfill(' ');
+    }
+}
+
+/*********************************************************************
+TraceRecorder::TraceRecorder(size_t iCapacity)
+Purpose:
+    Constructor that allocates the whole ring up front.
+Parameters:
+    I size_t iCapacity - Spans kept, rounded up to a power of two
+Return Value:
+    None (constructor)
+Notes:
+    Timestamps count from this moment.
+*********************************************************************/
+TraceRecorder::TraceRecorder(size_t iCapacity) : origin(std::chrono::steady_clock::now())
+{
+    size_t iSize = 1;
+    while(iSize < iCapacity) iSize <<= 1;
+    ring.resize(iSize);
+    iMask = iSize - 1;
+}
+
+/*********************************************************************
+void TraceRecorder::writeChromeJson(std::ostream& out) const
+Purpose:
+    Exports every span still in the ring in Chrome trace format.
+Parameters:
+    I/O std::ostream& out - Destination
+Return Value:
+    None
+Notes:
+    Each session becomes its own named thread in the viewer. Spans
+    are complete ("X") events written oldest first.
+*********************************************************************/
+void TraceRecorder::writeChromeJson(std::ostream& out) const
+{
+    size_t iCount = size();
+    uint64_t iFirst = iWritten - iCount;
+    std::set<uint32_t> tracks;
+
+    out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" << getDropped() << "},\"traceEvents\":[";
+    for(uint64_t i = iFirst; i < iWritten; i++)
+    {
+        const TraceEvent& event = ring[i & iMask];
+        tracks.insert(event.iTrack);
+        out << (i > iFirst ? ",\n" : "\n") << "{\"name\":\"" << event.pName << "\",\"cat\":\"" << event.pCategory
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.iTrack << ",\"ts\":";
+        writeMicros(out, event.iStartNs);
+        out << ",\"dur\":";
+        writeMicros(out, event.iDurationNs);
+        out << "}";
+    }
+    for(uint32_t iTrack : tracks)
+    {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << iTrack
+            << ",\"args\":{\"name\":\"session " << iTrack << "\"}}";
+    }
+    out << "\n]}\n";
+}
+
+/*********************************************************************
+void TraceRecorder::writeSummary(std::ostream& out) const
+Purpose:
+    Prints the time spent in each category and each span name.
+Parameters:
+    I/O std::ostream& out - Destination
+Return Value:
+    None
+Notes:
+    Step spans contain the render, parse, list and output spans run
+    inside them, so categories overlap; player spans are time spent
+    waiting for input.
+*********************************************************************/
+void TraceRecorder::writeSummary(std::ostream& out) const
+{
+    struct Total
+    {
+        uint64_t iCount = 0;
+        uint64_t iNs = 0;
+    };
+    std::map<std::string, Total> categories;
+    std::map<std::string, Total> names;
+
+    uint64_t iFirst = iWritten - size();
+    for(uint64_t i = iFirst; i < iWritten; i++)
+    {
+        const TraceEvent& event = ring[i & iMask];
+        Total& category = categories[event.pCategory];
+        category.iCount++;
+        category.iNs += event.iDurationNs;
+        Total& name = names[std::string(event.pCategory) + "/" + event.pName];
+        name.iCount++;
+        name.iNs += event.iDurationNs;
+    }
+
+    out << size() << " spans (" << getDropped() << " dropped)\n";
+    for(const std::map<std::string, Total>* totals : { &categories, &names })
+    {
+        for(const auto& entry : *totals)
+        {
+            out << "  " << std::left << std::setw(32) << entry.first << std::right << std::setw(10) << entry.second.iCount
+                << std::setw(14) << std::fixed << std::setprecision(3) << entry.second.iNs / 1e6 << " ms"
+                << std::defaultfloat << "\n";
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*********************************************************************
+File name: TraceRecorder.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the TraceRecorder class, a ring buffer of timed
+    spans exported in Chrome trace format.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Definitions for TraceEvent and TraceRecorder.
+Notes:
+    Load the exported JSON in chrome://tracing or ui.perfetto.dev.
+*********************************************************************/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/*********************************************************************
+Struct Name: TraceEvent
+Purpose:
+    One completed span.
+Notes:
+    Names and categories must be string literals; only the pointers
+    are stored.
+*********************************************************************/
+struct TraceEvent
+{
+    const char* pName = nullptr;       // What ran
+    const char* pCategory = nullptr;   // render, parse, list, output, step or player
+    uint64_t iStartNs = 0;             // Start, relative to the recorder's creation
+    uint64_t iDurationNs = 0;          // Length of the span
+    uint32_t iTrack = 0;               // Session the span belongs to
+};
+
+/*********************************************************************
+Class Name: TraceRecorder
+Purpose:
+    Keeps the most recent spans in a fixed ring so tracing can stay on
+    for long sessions without growing.
+Notes:
+    Recording is a clock read and a store into preallocated memory.
+    Not thread-safe: use one recorder per thread driving sessions.
+    Once the ring is full the oldest spans are overwritten and counted
+    as dropped.
+*********************************************************************/
+class TraceRecorder
+{
+    public:
+        /*********************************************************************
+        Class Name: Span
+        Purpose:
+            Records the time from its construction to its destruction.
+        Notes:
+            Does nothing when given a null recorder, so call sites can
+            trace unconditionally.
+        *********************************************************************/
+        class Span
+        {
+            private:
+                TraceRecorder* pRecorder;      // Destination, or nullptr
+                const char* pName;             // What ran
+                const char* pCategory;         // Kind of work
+                uint32_t iTrack;               // Session
+                uint64_t iStartNs;             // Start time
+
+            public:
+                Span(TraceRecorder* pTraceRecorder, const char* pSpanName, const char* pSpanCategory, uint32_t iSpanTrack) :
+                    pRecorder(pTraceRecorder), pName(pSpanName), pCategory(pSpanCategory), iTrack(iSpanTrack),
+                    iStartNs(pTraceRecorder != nullptr ? pTraceRecorder->now() : 0) {}
+                ~Span() { if(pRecorder != nullptr) pRecorder->record(pName, pCategory, iStartNs, pRecorder->now(), iTrack); }
+                Span(const Span&) = delete;
+                Span& operator=(const Span&) = delete;
+        };
+
+    private:
+        std::vector<TraceEvent> ring;                      // Event storage, a power of two long
+        size_t iMask;                                      // ring.size() - 1
+        uint64_t iWritten = 0;                             // Events ever recorded
+        std::chrono::steady_clock::time_point origin;      // Time zero for every event
+
+    public:
+        explicit TraceRecorder(size_t iCapacity = 65536);
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        uint64_t now() const
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now() - origin).count());
+        }
+
+        void record(const char* pName, const char* pCategory, uint64_t iStartNs, uint64_t iEndNs, uint32_t iTrack)
+        {
+            TraceEvent& event = ring[iWritten++ & iMask];
+            event.pName = pName;
+            event.pCategory = pCategory;
+            event.iStartNs = iStartNs;
+            event.iDurationNs = iEndNs - iStartNs;
+            event.iTrack = iTrack;
+        }
+
+        size_t size() const { return iWritten < ring.size() ? static_cast<size_t>(iWritten) : ring.size(); }
+        uint64_t getDropped() const { return iWritten - size(); }
+        void clear() { iWritten = 0; }
+        void writeChromeJson(std::ostream& out) const;
+        void writeSummary(std::ostream& out) const;
+};
@@ -0,0 +1,269 @@
+/*********************************************************************
+File name: WorkStealingPool.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Implementation file for the WorkStealingPool class.
+Command Parameters:
+    N/A
+Input:
+    Ranges of work from parallelFor().
+Results:
+    The work, spread across every core.
+Notes:
+    Bodies must not throw.
+*********************************************************************/
+
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    const size_t NOT_A_WORKER = std::numeric_limits<size_t>::max();
+    const size_t CHUNKS_PER_THREAD = 4;                     // Even split granularity, leaves room to steal
+
+    thread_local const WorkStealingPool* pCurrentPool = nullptr;   // Pool the current thread works for
+    thread_local size_t iCurrentQueue = NOT_A_WORKER;              // Its queue in that pool
+}
+
+/*********************************************************************
+WorkStealingPool::WorkStealingPool(unsigned iWorkers)
+Purpose:
+    Constructor that starts the worker threads.
+Parameters:
+    I unsigned iWorkers - Threads besides the caller's, 0 to run
+                          everything inline
+Return Value:
+    None (constructor)
+Notes:
+    None
+*********************************************************************/
+WorkStealingPool::WorkStealingPool(unsigned iWorkers)
+{
+    for(unsigned i = 0; i < iWorkers; i++) queues.emplace_back(new Queue());
+    for(unsigned i = 0; i < iWorkers; i++) workers.emplace_back(&WorkStealingPool::workerLoop, this, static_cast<size_t>(i));
+}
+
+/*********************************************************************
+WorkStealingPool::~WorkStealingPool()
+Purpose:
+    Destructor that lets the workers drain their queues and exit.
+Parameters:
+    None
+Return Value:
+    None (destructor)
+Notes:
+    None
+*********************************************************************/
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(idleLock);
+        bStopping = true;
+    }
+    idle.notify_all();
+    for(std::thread& worker : workers) worker.join();
+}
+
+/*********************************************************************
+void WorkStealingPool::workerLoop(size_t iQueue)
+Purpose:
+    Body of each worker thread.
+Parameters:
+    I size_t iQueue - The worker's own queue
+Return Value:
+    None
+Notes:
+    Sleeps only when no queue holds a task.
+*********************************************************************/
+void WorkStealingPool::workerLoop(size_t iQueue)
+{
+    pCurrentPool = this;
+    iCurrentQueue = iQueue;
+
+    while(true)
+    {
+        Task task;
+        if(findTask(task))
+        {
+            task.pRun(task.pBody, task.iBegin, task.iEnd);
+            task.pPending->fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(idleLock);
+        idle.wait(guard, [this]() { return bStopping || iQueued.load(std::memory_order_acquire) > 0; });
+        if(bStopping && iQueued.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+/*********************************************************************
+bool WorkStealingPool::popLocal(size_t iQueue, Task& task)
+Purpose:
+    Takes the newest task from a worker's own queue.
+Parameters:
+    I size_t iQueue - The worker's queue
+    O Task& task - The task taken
+Return Value:
+    bool - False if the queue was empty
+Notes:
+    Newest first keeps a recursive split working on data that is
+    still in cache.
+*********************************************************************/
+bool WorkStealingPool::popLocal(size_t iQueue, Task& task)
+{
+    Queue& queue = *queues[iQueue];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if(queue.tasks.empty()) return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    iQueued.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+/*********************************************************************
+bool WorkStealingPool::steal(size_t iThief, Task& task)
+Purpose:
+    Takes the oldest task from some other queue.
+Parameters:
+    I size_t iThief - The stealing worker's queue, or NOT_A_WORKER
+    O Task& task - The task taken
+Return Value:
+    bool - False if every other queue was empty
+Notes:
+    The oldest task is the biggest piece of a recursive split.
+*********************************************************************/
+bool WorkStealingPool::steal(size_t iThief, Task& task)
+{
+    size_t iQueues = queues.size();
+    size_t iStart = (iThief == NOT_A_WORKER) ? iNextQueue.load(std::memory_order_relaxed) : iThief + 1;
+    for(size_t i = 0; i < iQueues; i++)
+    {
+        size_t iVictim = (iStart + i) % iQueues;
+        if(iVictim == iThief) continue;
+        Queue& queue = *queues[iVictim];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if(queue.tasks.empty()) continue;
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+        iQueued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+/*********************************************************************
+bool WorkStealingPool::findTask(Task& task)
+Purpose:
+    Finds work for the current thread.
+Parameters:
+    O Task& task - The task found
+Return Value:
+    bool - False if there is no queued work
+Notes:
+    Workers try their own queue before stealing; other threads can
+    only steal.
+*********************************************************************/
+bool WorkStealingPool::findTask(Task& task)
+{
+    if(iQueued.load(std::memory_order_acquire) == 0) return false;
+    size_t iOwn = (pCurrentPool == this) ? iCurrentQueue : NOT_A_WORKER;
+    if(iOwn != NOT_A_WORKER && popLocal(iOwn, task)) return true;
+    return steal(iOwn, task);
+}
+
+/*********************************************************************
+void WorkStealingPool::push(size_t iQueue, const Task& task)
+Purpose:
+    Adds a task to the back of a queue.
+Parameters:
+    I size_t iQueue - Queue to add to
+    I const Task& task - Task to add
+Return Value:
+    None
+Notes:
+    Does not wake anyone; parallelRange() does that once per range.
+*********************************************************************/
+void WorkStealingPool::push(size_t iQueue, const Task& task)
+{
+    Queue& queue = *queues[iQueue];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    queue.tasks.push_back(task);
+    iQueued.fetch_add(1, std::memory_order_release);
+}
+
+/*********************************************************************
+void WorkStealingPool::parallelRange(size_t iCount, size_t iGrain, void (*pRun)(void*, size_t, size_t), void* pBody)
+Purpose:
+    Type-erased parallelFor().
+Parameters:
+    I size_t iCount - Size of the range
+    I size_t iGrain - Largest chunk, 0 for an even split
+    I void (*pRun)(void*, size_t, size_t) - Calls the body
+    I void* pBody - The body
+Return Value:
+    None
+Notes:
+    The caller keeps the first chunk and then runs queued tasks,
+    its own or anyone's, until all of its chunks have finished.
+*********************************************************************/
+void WorkStealingPool::parallelRange(size_t iCount, size_t iGrain, void (*pRun)(void*, size_t, size_t), void* pBody)
+{
+    if(iCount == 0) return;
+    if(iGrain == 0) iGrain = std::max<size_t>(1, (iCount + getConcurrency() * CHUNKS_PER_THREAD - 1) / (getConcurrency() * CHUNKS_PER_THREAD));
+    if(workers.empty() || iCount <= iGrain)
+    {
+        pRun(pBody, 0, iCount);
+        return;
+    }
+
+    size_t iChunks = (iCount + iGrain - 1) / iGrain;
+    std::atomic<size_t> iPending(iChunks);
+    size_t iOwn = (pCurrentPool == this) ? iCurrentQueue : NOT_A_WORKER;
+    for(size_t iChunk = 1; iChunk < iChunks; iChunk++)
+    {
+        size_t iQueue = (iOwn != NOT_A_WORKER) ? iOwn : iNextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        push(iQueue, Task{ pRun, pBody, iChunk * iGrain, std::min(iCount, (iChunk + 1) * iGrain), &iPending });
+    }
+    {
+        std::lock_guard<std::mutex> guard(idleLock);
+    }
+    idle.notify_all();
+
+    pRun(pBody, 0, iGrain);
+    iPending.fetch_sub(1, std::memory_order_release);
+
+    while(iPending.load(std::memory_order_acquire) > 0)
+    {
+        Task task;
+        if(findTask(task))
+        {
+            task.pRun(task.pBody, task.iBegin, task.iEnd);
+            task.pPending->fetch_sub(1, std::memory_order_release);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/*********************************************************************
+WorkStealingPool& WorkStealingPool::shared()
+Purpose:
+    The process-wide pool.
+Parameters:
+    None
+Return Value:
+    WorkStealingPool& - Pool with one worker per extra core
+Notes:
+    Started on first use, so programs that never go parallel never
+    start a thread.
+*********************************************************************/
+WorkStealingPool& WorkStealingPool::shared()
+{
+    static WorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
@@ -0,0 +1,124 @@
+/*********************************************************************
+File name: WorkStealingPool.hpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Header file for the WorkStealingPool class, a fixed set of worker
+    threads that split ranges of work between them.
+Command Parameters:
+    N/A
+Input:
+    N/A
+Results:
+    Class definition for WorkStealingPool.
+Notes:
+    One pool is meant to be shared by everything in the process; see
+    WorkStealingPool::shared().
+*********************************************************************/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*********************************************************************
+Class Name: WorkStealingPool
+Purpose:
+    Runs parallelFor() ranges on worker threads plus the calling
+    thread.
+Notes:
+    Each worker owns a deque of range chunks. It pops its own work
+    from the back, newest first, and when that runs dry steals the
+    oldest chunk from another worker's front. The thread that called
+    parallelFor() runs chunks too until its range is done, so a
+    parallelFor() inside a chunk never waits on a blocked worker and
+    recursive splits (sorting, tree walks) are safe. A pool of zero
+    workers runs everything on the caller.
+*********************************************************************/
+class WorkStealingPool
+{
+    private:
+        /*********************************************************************
+        Struct Name: Task
+        Purpose:
+            One chunk of a parallelFor() range.
+        Notes:
+            pPending belongs to the parallelFor() call waiting on it.
+        *********************************************************************/
+        struct Task
+        {
+            void (*pRun)(void*, size_t, size_t);   // Calls the body on [iBegin, iEnd)
+            void* pBody;                          // The body
+            size_t iBegin;                        // First index of the chunk
+            size_t iEnd;                          // One past the last index
+            std::atomic<size_t>* pPending;        // Chunks of the range not yet finished
+        };
+
+        /*********************************************************************
+        Struct Name: Queue
+        Purpose:
+            A worker's deque and its lock.
+        Notes:
+            Aligned so neighbouring queues do not share a cache line.
+        *********************************************************************/
+        struct alignas(64) Queue
+        {
+            std::mutex lock;            // Guards tasks
+            std::deque<Task> tasks;     // Owner uses the back, thieves the front
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;   // One per worker
+        std::vector<std::thread> workers;             // Worker threads
+        std::atomic<size_t> iQueued{0};               // Tasks sitting in any queue
+        std::atomic<size_t> iNextQueue{0};            // Round-robin target for outside callers
+        std::mutex idleLock;                          // Guards sleeping workers
+        std::condition_variable idle;                 // Wakes workers when work arrives
+        bool bStopping = false;                       // Set by the destructor
+
+        void workerLoop(size_t iQueue);
+        bool popLocal(size_t iQueue, Task& task);
+        bool steal(size_t iThief, Task& task);
+        bool findTask(Task& task);
+        void push(size_t iQueue, const Task& task);
+        void parallelRange(size_t iCount, size_t iGrain, void (*pRun)(void*, size_t, size_t), void* pBody);
+
+    public:
+        explicit WorkStealingPool(unsigned iWorkers);
+        ~WorkStealingPool();
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        unsigned getWorkerCount() const { return static_cast<unsigned>(workers.size()); }
+        unsigned getConcurrency() const { return getWorkerCount() + 1; }
+
+        /*********************************************************************
+        void parallelFor(size_t iCount, size_t iGrain, Body&& body)
+        Purpose:
+            Calls body(iBegin, iEnd) over chunks of [0, iCount) in
+            parallel and returns once every chunk is done.
+        Parameters:
+            I size_t iCount - Size of the range
+            I size_t iGrain - Largest chunk handed to one call, 0 to
+                              split evenly across the pool
+            I Body&& body - Callable taking (size_t, size_t)
+        Notes:
+            Chunks run in no particular order and on any thread.
+        *********************************************************************/
+        template<typename Body>
+        void parallelFor(size_t iCount, size_t iGrain, Body&& body)
+        {
+            using BodyType = std::remove_reference_t<Body>;
+            parallelRange(iCount, iGrain,
+                          [](void* pBody, size_t iBegin, size_t iEnd) { (*static_cast<BodyType*>(pBody))(iBegin, iEnd); },
+                          const_cast<void*>(static_cast<const void*>(&body)));
+        }
+
+        static WorkStealingPool& shared();
+};
@@ -0,0 +1,1335 @@
+/*********************************************************************
+File name: benchmark_driver.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Benchmark driver for the Airship Delivery System data structures.
+Command Parameters:
+    None
+Input:
+    None
+Results:
+    Prints timings for the manifest operations to standard output.
+Notes:
+    Build and run with "make bench".
+*********************************************************************/
+
+#include "AirshipOrderList.hpp"
+#include "BatchSimulator.hpp"
+#include "ConcurrentAirshipOrderList.hpp"
+#include "Credits.hpp"
+#include "DeliveryIngestQueue.hpp"
+#include "DeliverySearchIndex.hpp"
+#include "DisplayManager.hpp"
+#include "GameManager.hpp"
+#include "InputReader.hpp"
+#include "ListInstrumentation.hpp"
+#include "ManifestCheckpointer.hpp"
+#include "ManifestLog.hpp"
+#include "OutputSink.hpp"
+#include "ScenarioGenerator.hpp"
+#include "SceneFormatter.hpp"
+#include "SessionFootprint.hpp"
+#include "SessionRecorder.hpp"
+#include "SessionReplayer.hpp"
+#include "SessionScheduler.hpp"
+#include "TraceRecorder.hpp"
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <malloc.h>
+#include <unistd.h>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock BenchClock;
+
+    /*********************************************************************
+    double elapsedMs(BenchClock::time_point start)
+    Purpose:
+        Milliseconds elapsed since start.
+    *********************************************************************/
+    double elapsedMs(BenchClock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+    }
+
+    /*********************************************************************
+    std::vector<DeliveryRecord> makeRecords(size_t iCount)
+    Purpose:
+        Builds iCount distinct delivery records.
+    *********************************************************************/
+    std::vector<DeliveryRecord> makeRecords(size_t iCount)
+    {
+        std::vector<DeliveryRecord> records(iCount);
+        for(size_t i = 0; i < iCount; i++)
+        {
+            records[i].szName = "Customer " + std::to_string(i);
+            records[i].szItem = "Crate " + std::to_string(i % 977);
+            records[i].iQuantity = static_cast<int>(i % 50) + 1;
+            records[i].cost = Credits::fromCents(static_cast<int64_t>(i % 1000) * 100 + 50);
+        }
+        return records;
+    }
+
+    /*********************************************************************
+    void benchBatchMutations()
+    Purpose:
+        Applies 100k modify and 100k remove edits to a 1M-row manifest.
+    *********************************************************************/
+    void benchBatchMutations()
+    {
+        const size_t iRows = 1000000;
+        const size_t iEdits = 100000;
+        std::vector<DeliveryRecord> records = makeRecords(iRows);
+
+        AirshipOrderList list;
+        BenchClock::time_point start = BenchClock::now();
+        list.addDeliveries(records);
+        std::cout << "addDeliveries     " << iRows << " rows: " << elapsedMs(start) << " ms\n";
+
+        std::vector<DeliveryRecord> edits;
+        edits.reserve(iEdits);
+        for(size_t i = 0; i < iEdits; i++)
+        {
+            edits.push_back(records[(i * 7919) % iRows]);
+            edits.back().iQuantity += 1;
+        }
+
+        start = BenchClock::now();
+        std::vector<bool> modified = list.modifyDeliveries(edits);
+        std::cout << "modifyDeliveries  " << iEdits << " edits: " << elapsedMs(start) << " ms\n";
+
+        start = BenchClock::now();
+        std::vector<bool> removed = list.removeDeliveries(edits);
+        std::cout << "removeDeliveries  " << iEdits << " edits: " << elapsedMs(start) << " ms ("
+                  << list.size() << " rows left)\n";
+
+        (void)modified;
+        (void)removed;
+    }
+
+    /*********************************************************************
+    struct BigLockOrderList
+    Purpose:
+        The old approach of one plain mutex around the whole list, kept
+        as the baseline for the contention benchmark.
+    *********************************************************************/
+    struct BigLockOrderList
+    {
+        std::mutex listMutex;
+        AirshipOrderList orderList;
+
+        void addDelivery(const std::string& szCust, const std::string& szItm, int iQty, Credits cost)
+        {
+            std::lock_guard<std::mutex> lock(listMutex);
+            orderList.addDelivery(szCust, szItm, iQty, cost);
+        }
+        bool removeDelivery(const std::string& szCust, const std::string& szItm)
+        {
+            std::lock_guard<std::mutex> lock(listMutex);
+            return orderList.removeDelivery(szCust, szItm);
+        }
+        bool findDelivery(const std::string& szCust, const std::string& szItm, DeliveryRecord& found)
+        {
+            std::lock_guard<std::mutex> lock(listMutex);
+            const Delivery* delivery = orderList.findDelivery(szCust, szItm);
+            if(delivery == nullptr) return false;
+            found.iQuantity = delivery->iQuantity;
+            return true;
+        }
+    };
+
+    /*********************************************************************
+    void benchSmallManifests()
+    Purpose:
+        Builds, searches and tears down a million shift-sized
+        manifests, and measures the heap held by 10k live ones.
+    *********************************************************************/
+    void benchSmallManifests()
+    {
+        const size_t iManifests = 1000000;
+        const size_t iLive = 10000;
+        const char* names[] = { "Bulk Ryker", "Buck Hawthorne", "Old Man Ripple", "Bramble Nett", "Vesper Morrow", "Linton Yarrow" };
+        const char* items[] = { "Protein Infusion Canisters", "Classic Ale Keg", "Net-Stabilizer Kit",
+                                "Cultivation Spore Beds", "EM Field Sensor", "Soft-Code Debugging Array" };
+        const std::string szTarget = names[5];
+        const std::string szTargetItem = items[5];
+
+        size_t iFound = 0;
+        BenchClock::time_point start = BenchClock::now();
+        for(size_t i = 0; i < iManifests; i++)
+        {
+            AirshipOrderList list;
+            for(size_t j = 0; j < 6; j++) list.addDelivery(names[j], items[j], 1, Credits::fromCents(10000));
+            iFound += list.findDelivery(szTarget, szTargetItem) != nullptr ? 1 : 0;
+            list.modifyDelivery(szTarget, szTargetItem, 2, Credits::fromCents(32000));
+        }
+        double dMs = elapsedMs(start);
+
+        size_t iHeapBefore = mallinfo2().uordblks;
+        std::vector<std::unique_ptr<AirshipOrderList>> lists;
+        lists.reserve(iLive);
+        size_t iVectorBytes = mallinfo2().uordblks - iHeapBefore;
+        for(size_t i = 0; i < iLive; i++)
+        {
+            lists.emplace_back(new AirshipOrderList());
+            for(size_t j = 0; j < 6; j++) lists.back()->addDelivery(names[j], items[j], 1, Credits::fromCents(10000));
+        }
+        size_t iHeapPerList = (mallinfo2().uordblks - iHeapBefore - iVectorBytes) / iLive;
+        std::cout << "small manifests   " << iManifests << " x 6 rows: " << dMs * 1e6 / iManifests << " ns each ("
+                  << iFound << " found), " << iHeapPerList << " B heap per manifest for a " << sizeof(AirshipOrderList)
+                  << " B object\n";
+    }
+
+    /*********************************************************************
+    template <typename ListType> double runContention(ListType& list, const std::vector<DeliveryRecord>& records, int iThreads, size_t iTotalOps)
+    Purpose:
+        Runs a 90% find / 10% add+remove mix on iThreads threads and
+        returns the wall time in milliseconds.
+    *********************************************************************/
+    template <typename ListType>
+    double runContention(ListType& list, const std::vector<DeliveryRecord>& records, int iThreads, size_t iTotalOps)
+    {
+        std::vector<std::thread> workers;
+        size_t iOpsPerThread = iTotalOps / static_cast<size_t>(iThreads);
+        BenchClock::time_point start = BenchClock::now();
+
+        for(int t = 0; t < iThreads; t++)
+        {
+            workers.emplace_back([&list, &records, t, iOpsPerThread]()
+            {
+                DeliveryRecord found;
+                std::string szOwnName = "Writer " + std::to_string(t);
+                for(size_t i = 0; i < iOpsPerThread; i++)
+                {
+                    if(i % 10 == 0)
+                    {
+                        list.addDelivery(szOwnName, "Ballast", 1, Credits::fromCents(100));
+                        list.removeDelivery(szOwnName, "Ballast");
+                    }
+                    else
+                    {
+                        const DeliveryRecord& target = records[(i * 31 + static_cast<size_t>(t)) % records.size()];
+                        list.findDelivery(target.szName, target.szItem, found);
+                    }
+                }
+            });
+        }
+        for(std::thread& worker : workers) worker.join();
+        return elapsedMs(start);
+    }
+
+    /*********************************************************************
+    void benchContention()
+    Purpose:
+        Compares the shared-lock list against one big mutex at 1 to 64
+        threads on a 1000-row manifest.
+    *********************************************************************/
+    void benchContention()
+    {
+        const size_t iRows = 1000;
+        const size_t iTotalOps = 64000;
+        std::vector<DeliveryRecord> records = makeRecords(iRows);
+
+        ConcurrentAirshipOrderList concurrentList;
+        BigLockOrderList bigLockList;
+        concurrentList.addDeliveries(records);
+        bigLockList.orderList.addDeliveries(records);
+
+        std::cout << "threads   shared-lock ops/s   big-lock ops/s\n";
+        for(int iThreads = 1; iThreads <= 64; iThreads *= 2)
+        {
+            double dShared = runContention(concurrentList, records, iThreads, iTotalOps);
+            double dBig = runContention(bigLockList, records, iThreads, iTotalOps);
+            std::cout << std::setw(7) << iThreads
+                      << std::setw(20) << static_cast<long long>(iTotalOps / dShared * 1000.0)
+                      << std::setw(17) << static_cast<long long>(iTotalOps / dBig * 1000.0) << "\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchIngestQueue()
+    Purpose:
+        Measures enqueue latency percentiles and sustained ingest rate
+        with several producers feeding one applier thread.
+    *********************************************************************/
+    void benchIngestQueue()
+    {
+        const size_t iPerProducer = 200000;
+        const size_t iMaxBatch = 4096;
+
+        for(int iProducers = 1; iProducers <= 16; iProducers *= 4)
+        {
+            DeliveryIngestQueue queue;
+            ConcurrentAirshipOrderList orderList;
+            size_t iTotal = iPerProducer * static_cast<size_t>(iProducers);
+            std::vector<std::vector<long long>> latencies(static_cast<size_t>(iProducers));
+            std::vector<std::thread> producers;
+
+            BenchClock::time_point start = BenchClock::now();
+            std::thread applier([&queue, &orderList, iTotal, iMaxBatch]()
+            {
+                size_t iApplied = 0;
+                while(iApplied < iTotal)
+                {
+                    size_t iDrained = queue.drainInto(orderList, iMaxBatch);
+                    if(iDrained == 0) std::this_thread::yield();
+                    iApplied += iDrained;
+                }
+            });
+
+            for(int p = 0; p < iProducers; p++)
+            {
+                producers.emplace_back([&queue, &latencies, p, iPerProducer]()
+                {
+                    std::vector<long long>& samples = latencies[static_cast<size_t>(p)];
+                    samples.reserve(iPerProducer);
+                    DeliveryRecord record;
+                    record.szName = "Terminal " + std::to_string(p);
+                    record.szItem = "Crate";
+                    for(size_t i = 0; i < iPerProducer; i++)
+                    {
+                        record.iQuantity = static_cast<int>(i % 50) + 1;
+                        record.cost = Credits::fromCents(static_cast<int64_t>(i % 1000) * 100);
+                        BenchClock::time_point before = BenchClock::now();
+                        queue.enqueue(record);
+                        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - before).count());
+                    }
+                });
+            }
+            for(std::thread& producer : producers) producer.join();
+            applier.join();
+            double dMs = elapsedMs(start);
+
+            std::vector<long long> all;
+            for(const std::vector<long long>& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+            std::sort(all.begin(), all.end());
+            std::cout << "ingest " << std::setw(2) << iProducers << " producers: "
+                      << static_cast<long long>(iTotal / dMs * 1000.0) << " rows/s, enqueue ns p50 "
+                      << all[all.size() / 2] << " p99 " << all[all.size() * 99 / 100]
+                      << " p99.9 " << all[all.size() * 999 / 1000] << " max " << all.back()
+                      << " (" << orderList.size() << " applied)\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchManifestLog()
+    Purpose:
+        Measures append throughput under each durability setting and
+        the time to replay a large log.
+    *********************************************************************/
+    void benchManifestLog()
+    {
+        const char* szPath = "benchmark_manifest.wal";
+        const size_t iRecords = 1000000;
+        std::vector<DeliveryRecord> records = makeRecords(iRecords);
+
+        struct ModeRun { const char* szLabel; LogSyncMode mode; int iThreads; size_t iCount; };
+        const ModeRun runs[] = {
+            {"buffered        ", LogSyncMode::Buffered, 1, iRecords},
+            {"periodic 10ms   ", LogSyncMode::Periodic, 1, iRecords},
+            {"group commit x1 ", LogSyncMode::GroupCommit, 1, 2000},
+            {"group commit x16", LogSyncMode::GroupCommit, 16, 16000}
+        };
+
+        for(const ModeRun& run : runs)
+        {
+            std::remove(szPath);
+            ManifestLogOptions options;
+            options.syncMode = run.mode;
+            BenchClock::time_point start = BenchClock::now();
+            {
+                ManifestLog manifestLog(szPath, options);
+                std::vector<std::thread> writers;
+                size_t iPerThread = run.iCount / static_cast<size_t>(run.iThreads);
+                for(int t = 0; t < run.iThreads; t++)
+                {
+                    writers.emplace_back([&manifestLog, &records, t, iPerThread]()
+                    {
+                        for(size_t i = 0; i < iPerThread; i++)
+                        {
+                            const DeliveryRecord& record = records[static_cast<size_t>(t) * iPerThread + i];
+                            manifestLog.logAdd(record.szName, record.szItem, record.iQuantity, record.cost);
+                        }
+                    });
+                }
+                for(std::thread& writer : writers) writer.join();
+            }
+            double dMs = elapsedMs(start);
+            std::cout << "wal " << run.szLabel << " " << static_cast<long long>(run.iCount / dMs * 1000.0) << " records/s\n";
+        }
+
+        std::remove(szPath);
+        {
+            ManifestLogOptions options;
+            options.syncMode = LogSyncMode::Buffered;
+            ManifestLog manifestLog(szPath, options);
+            for(const DeliveryRecord& record : records)
+            {
+                manifestLog.logAdd(record.szName, record.szItem, record.iQuantity, record.cost);
+            }
+            for(size_t i = 0; i < iRecords; i += 10)
+            {
+                manifestLog.logModify(records[i].szName, records[i].szItem, 1, Credits::fromCents(100));
+            }
+        }
+
+        AirshipOrderList recovered;
+        BenchClock::time_point start = BenchClock::now();
+        size_t iApplied = ManifestLog::replay(szPath, recovered);
+        std::cout << "wal recovery      " << iApplied << " records: " << elapsedMs(start) << " ms\n";
+        std::remove(szPath);
+    }
+
+    /*********************************************************************
+    void benchCheckpoints()
+    Purpose:
+        Compares full log replay against checkpoint recovery as the
+        shift (number of logged edits) grows over a 100k-row manifest,
+        then checks recovery from a pass interrupted after sealing a
+        segment but before writing its checkpoint.
+    *********************************************************************/
+    void benchCheckpoints()
+    {
+        const char* szLogPath = "benchmark_checkpoint.wal";
+        const std::string szCheckpointPath = std::string(szLogPath) + ".checkpoint";
+        const size_t iRows = 100000;
+        const size_t iCheckpointEvery = 250000;
+        std::vector<DeliveryRecord> records = makeRecords(iRows);
+
+        for(size_t iShiftEdits = 1000000; iShiftEdits <= 4000000; iShiftEdits *= 2)
+        {
+            double dRecoverMs[2];
+            for(int iWithCheckpoints = 0; iWithCheckpoints < 2; iWithCheckpoints++)
+            {
+                {
+                    ManifestLogOptions options;
+                    options.syncMode = LogSyncMode::Buffered;
+                    ManifestLog manifestLog(szLogPath, options);
+                    ManifestCheckpointer checkpointer(manifestLog, szCheckpointPath, 0);
+                    checkpointer.discard();
+
+                    for(const DeliveryRecord& record : records)
+                    {
+                        manifestLog.logAdd(record.szName, record.szItem, record.iQuantity, record.cost);
+                    }
+                    for(size_t i = 0; i < iShiftEdits; i++)
+                    {
+                        const DeliveryRecord& record = records[(i * 7919) % iRows];
+                        manifestLog.logModify(record.szName, record.szItem, static_cast<int>(i % 90) + 1, record.cost);
+                        if(iWithCheckpoints == 1 && i % iCheckpointEvery == iCheckpointEvery - 1) checkpointer.checkpointNow();
+                    }
+                }
+
+                AirshipOrderList recovered;
+                BenchClock::time_point start = BenchClock::now();
+                ManifestCheckpointer::recover(szLogPath, szCheckpointPath, recovered);
+                dRecoverMs[iWithCheckpoints] = elapsedMs(start);
+            }
+            std::cout << "recovery after " << std::setw(7) << iShiftEdits << " edits: full replay "
+                      << dRecoverMs[0] << " ms, checkpoint + tail " << dRecoverMs[1] << " ms\n";
+        }
+
+        {
+            ManifestLog manifestLog(szLogPath);
+            ManifestCheckpointer(manifestLog, szCheckpointPath, 0).discard();
+            manifestLog.logAdd(records[0].szName, records[0].szItem, records[0].iQuantity, records[0].cost);
+            manifestLog.logAdd(records[1].szName, records[1].szItem, records[1].iQuantity, records[1].cost);
+            manifestLog.rotate();
+        }
+        size_t iRecovered[2];
+        uint64_t iRecoveredLsn[2];
+        for(int iRestart = 0; iRestart < 2; iRestart++)
+        {
+            AirshipOrderList recovered;
+            ManifestCheckpointer::recover(szLogPath, szCheckpointPath, recovered, &iRecoveredLsn[iRestart]);
+            iRecovered[iRestart] = recovered.size();
+            ManifestLog manifestLog(szLogPath);
+            manifestLog.advanceLsn(iRecoveredLsn[iRestart]);
+            ManifestCheckpointer(manifestLog, szCheckpointPath, 0).checkpointNow();
+        }
+        std::cout << "recovery after an interrupted checkpoint: " << iRecovered[0] << " then " << iRecovered[1]
+                  << " deliveries at lsn " << iRecoveredLsn[0] << " then " << iRecoveredLsn[1]
+                  << ((iRecovered[1] == 2 && iRecoveredLsn[1] == 2) ? " (ok)" : " (LOST RECORDS)") << "\n";
+
+        ManifestLog manifestLog(szLogPath);
+        ManifestCheckpointer(manifestLog, szCheckpointPath, 0).discard();
+        std::remove(szLogPath);
+    }
+
+    /*********************************************************************
+    void benchInputReader()
+    Purpose:
+        Parses a 1M-line prompt script (name, quantity, cost lines)
+        the way GameManager does and with the old iostream calls.
+    *********************************************************************/
+    void benchInputReader()
+    {
+        const char* szPath = "benchmark_input.txt";
+        const size_t iLines = 1000000;
+        {
+            std::ofstream script(szPath);
+            for(size_t i = 0; i < iLines / 3; i++)
+            {
+                script << "Customer " << i << "\n" << (i % 50) + 1 << "\n" << (i % 1000) << ".25\n";
+            }
+        }
+
+        std::string szName;
+        int iQuantity = 0;
+        double dCost = 0.0;
+        double dChecksum = 0.0;
+
+        BenchClock::time_point start = BenchClock::now();
+        {
+            int iFd = ::open(szPath, O_RDONLY);
+            InputReader reader(iFd);
+            std::string szQuantity;
+            std::string szCost;
+            Credits cost;
+            while(reader.readLine(szName) && reader.readLine(szQuantity) && reader.readLine(szCost))
+            {
+                if(InputReader::parseInt(szQuantity, iQuantity) && InputReader::parseCredits(szCost, cost))
+                {
+                    dChecksum += iQuantity + cost.toDouble();
+                }
+            }
+            ::close(iFd);
+        }
+        double dReaderMs = elapsedMs(start);
+
+        start = BenchClock::now();
+        {
+            std::ifstream script(szPath);
+            while(std::getline(script >> std::ws, szName) && script >> iQuantity && script >> dCost)
+            {
+                script.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                dChecksum -= iQuantity + dCost;
+            }
+        }
+        double dStreamMs = elapsedMs(start);
+
+        std::cout << "input " << iLines << " lines: InputReader " << dReaderMs << " ms, iostream "
+                  << dStreamMs << " ms (checksum " << dChecksum << ")\n";
+        std::remove(szPath);
+    }
+
+    /*********************************************************************
+    const std::string& scriptedShift()
+    Purpose:
+        Player input for one full winning shift.
+    *********************************************************************/
+    const std::string& scriptedShift()
+    {
+        static const std::string szScript =
+            "\n"
+            "Bulk Ryker\nProtein Infusion Canisters\n4\n200\n\n"
+            "Buck Hawthorne\nClassic Ale Keg\n1\n90\n\n"
+            "Old Man Ripple\nNet-Stabilizer Kit\n2\n120\n\n"
+            "Bramble Nett\nCultivation Spore Beds\n3\n150\n\n"
+            "Vesper Morrow\nEM Field Sensor\n1\n110\n\n"
+            "Linton Yarrow\nSoft-Code Debugging Array\n1\n320\n\n"
+            "4\n\n3\nBulk Ryker\nProtein Infusion Canisters\n5\n250\n\n"
+            "2\nBulk Ryker\nProtein Infusion Canisters\n\n"
+            "5\nLinton Yarrow\nSoft-Code Debugging Array\ny\n\n";
+        return szScript;
+    }
+
+    /*********************************************************************
+    size_t runScriptedSession(const std::string& szScript, OutputSink& sink)
+    Purpose:
+        Plays one full shift from a script, writing every screen to sink.
+        The script is read through a pipe one byte at a time, like a
+        terminal delivering a line per prompt, so every prompt flushes.
+    *********************************************************************/
+    size_t runScriptedSession(const std::string& szScript, OutputSink& sink)
+    {
+        static const DisplayManager displayManager;
+        AirshipOrderList airshipOrderList;
+        int pipeFds[2];
+        if(::pipe(pipeFds) != 0) return 0;
+        if(::write(pipeFds[1], szScript.data(), szScript.size()) != static_cast<ssize_t>(szScript.size())) return 0;
+        ::close(pipeFds[1]);
+
+        InputReader input(pipeFds[0], 1);
+        size_t iStartCalls = sink.getWriteCalls();
+        {
+            GameManager gameManager(airshipOrderList, input, sink);
+            gameManager.runShift(displayManager);
+        }
+        ::close(pipeFds[0]);
+        return sink.getWriteCalls() - iStartCalls;
+    }
+
+    /*********************************************************************
+    void benchOutputSink()
+    Purpose:
+        Counts output writes per scripted shift with an unbuffered sink,
+        a stdio-sized buffer and the default prompt-flushed buffer.
+    *********************************************************************/
+    void benchOutputSink()
+    {
+        const std::string& szScript = scriptedShift();
+        const int iSessions = 2000;
+        const size_t bufferSizes[] = { 0, 4096, 64 * 1024 };
+
+        for(size_t iBufferBytes : bufferSizes)
+        {
+            NullSink sink(iBufferBytes);
+            size_t iWrites = 0;
+            BenchClock::time_point start = BenchClock::now();
+            for(int i = 0; i < iSessions; i++)
+            {
+                iWrites += runScriptedSession(szScript, sink);
+            }
+            double dMs = elapsedMs(start);
+            std::cout << "output " << iBufferBytes << "-byte buffer: " << iWrites / iSessions
+                      << " writes/session, " << dMs * 1000.0 / iSessions << " us/session\n";
+        }
+
+        const char* szPath = "benchmark_transcript.txt";
+        {
+            FileSink transcript(szPath);
+            BenchClock::time_point start = BenchClock::now();
+            size_t iWrites = runScriptedSession(szScript, transcript);
+            std::cout << "output transcript file: " << iWrites << " writes, " << elapsedMs(start) << " ms\n";
+        }
+        std::remove(szPath);
+    }
+
+    /*********************************************************************
+    void benchSceneFormatter()
+    Purpose:
+        Renders customer scenes from profiles into one reused buffer
+        and compares against building each scene by concatenation.
+    *********************************************************************/
+    void benchSceneFormatter()
+    {
+        const size_t iScenes = 1000000;
+        const std::string_view szSprite = "          .---.              .//|\\.              .---.\n"
+                                          "________ / .-. \\_________..-~ _.-._ ~-..________ / .-. \\_________\n";
+        const CustomerProfile profiles[] = {
+            { "Bulk Ryker", "January 17 – 00:12", "Protein Infusion Canisters", 4, 200.0,
+              "That programmer kid, Linton? I wouldn't trust him with my gym bag.", "25 * 5 is 100", szSprite },
+            { "Vesper Morrow", "January 17 – 01:26", "EM Field Sensor", 1, 110.0,
+              "That old-timer, Buck? Always watching, always listening.", "Patterns love liars.", szSprite },
+            { "Linton Yarrow", "January 17 – 01:48", "Quantum Flux Capacitor", 2, 1234.5,
+              "Bramble counts everything twice. Ask her why.", "", szSprite } };
+        const size_t iProfiles = sizeof(profiles) / sizeof(profiles[0]);
+
+        SceneFormatter formatter;
+        std::string buffer;
+        size_t iBytes = 0;
+        formatter.render(profiles[0], buffer);
+        size_t iHeapBefore = mallinfo2().uordblks;
+        BenchClock::time_point start = BenchClock::now();
+        for(size_t i = 0; i < iScenes; i++)
+        {
+            formatter.render(profiles[i % iProfiles], buffer);
+            iBytes += buffer.size();
+        }
+        double dMs = elapsedMs(start);
+        size_t iHeapGrowth = mallinfo2().uordblks - iHeapBefore;
+
+        size_t iConcatBytes = 0;
+        start = BenchClock::now();
+        for(size_t i = 0; i < iScenes; i++)
+        {
+            const CustomerProfile& profile = profiles[i % iProfiles];
+            std::string szName(profile.szName);
+            std::string szItem(profile.szItem);
+            std::string scene = std::string(profile.szSprite) + "\n[" + std::string(profile.szArrival) + ", " + szName +
+                                " Arrives]\n\n" + szName + ": \"" + szItem + ". " + std::to_string(profile.iQuantity) +
+                                " units. Cost: " + std::to_string(profile.dCost) + ".\"\n\n" + szName + ": \"" +
+                                std::string(profile.szAccusation) + "\"\n\n" + szName + ": \"" + std::string(profile.szRiddle) +
+                                "\"\n\nYou log:\n    Name: " + szName + " |\n    Item: " + szItem + " |\n";
+            iConcatBytes += scene.size();
+        }
+        double dConcatMs = elapsedMs(start);
+
+        std::cout << "scene formatter " << iScenes << " scenes: " << iScenes / (dMs / 1000.0) << " scenes/s, "
+                  << iBytes / iScenes << " B/scene, heap growth " << iHeapGrowth << " B; concatenation "
+                  << iScenes / (dConcatMs / 1000.0) << " scenes/s (" << iConcatBytes / iScenes << " B/scene)\n";
+    }
+
+    /*********************************************************************
+    void benchScenarios()
+    Purpose:
+        Generates seeded scenarios from 6 to 10M orders, loads each
+        into a manifest and plays the guessing phase against it with
+        GameManager, removing a planted fraud. Small scenarios are
+        also played customer by customer from their generated script.
+    *********************************************************************/
+    void benchScenarios()
+    {
+        static const DisplayManager displayManager;
+        const size_t scenarioSizes[] = { 6, 1000, 100000, 10000000 };
+        const uint64_t iSeed = 2025;
+
+        for(size_t iCustomers : scenarioSizes)
+        {
+            ScenarioGenerator scenario(iSeed, iCustomers, 1 + iCustomers / 100000);
+            NullSink sink(4096);
+            ScenarioOrder fraud;
+            scenario.order(scenario.getFraudulent().back(), fraud);
+            std::string szGuess = "5\n" + fraud.szName + "\n" + std::string(fraud.szItem) + "\ny\n\n";
+
+            std::unique_ptr<AirshipOrderList> airshipOrderList(new AirshipOrderList());
+            BenchClock::time_point start = BenchClock::now();
+            scenario.loadInto(*airshipOrderList);
+            double dLoadMs = elapsedMs(start);
+
+            start = BenchClock::now();
+            bool bVictory = false;
+            {
+                GameManager gameManager(*airshipOrderList, sink);
+                gameManager.setScenario(&scenario);
+                gameManager.start(displayManager, iCustomers);
+                InputReader lines(szGuess);
+                std::string szLine;
+                while(!gameManager.isFinished() && lines.readLine(szLine)) gameManager.step(szLine);
+                bVictory = gameManager.getIsGuessCorrect();
+            }
+            double dGuessMs = elapsedMs(start);
+
+            std::cout << "scenario " << iCustomers << " orders (" << scenario.getFraudulent().size() << " planted): load "
+                      << dLoadMs << " ms (" << iCustomers / (dLoadMs / 1000.0) << " orders/s), guess " << dGuessMs
+                      << " ms, " << (bVictory ? "victory" : "defeat") << ", "
+                      << airshipOrderList->footprintBytes() / iCustomers << " B/order";
+
+            if(iCustomers <= 1000)
+            {
+                std::string szScript;
+                scenario.writeScript(szScript);
+                szScript += szGuess;
+                std::unique_ptr<AirshipOrderList> playedList(new AirshipOrderList());
+                start = BenchClock::now();
+                GameManager gameManager(*playedList, sink);
+                gameManager.setScenario(&scenario);
+                gameManager.start(displayManager);
+                InputReader lines(szScript);
+                std::string szLine;
+                size_t iSteps = 0;
+                while(!gameManager.isFinished() && lines.readLine(szLine))
+                {
+                    gameManager.step(szLine);
+                    iSteps++;
+                }
+                double dPlayMs = elapsedMs(start);
+                std::cout << "; played " << iSteps << " steps in " << dPlayMs << " ms, "
+                          << (gameManager.getIsGuessCorrect() ? "victory" : "defeat");
+            }
+            std::cout << "\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchBatchSimulation()
+    Purpose:
+        Plays generated shifts with each bot strategy on pools of 1 to
+        every core and reports win rates and games/s/core.
+    *********************************************************************/
+    void benchBatchSimulation()
+    {
+        const size_t iGames = 20000;
+        const BotStrategy strategies[] = { BotStrategy::Random, BotStrategy::CheapestPerUnit, BotStrategy::ClueFollowing };
+        unsigned iCores = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned> threadCounts;
+        for(unsigned iThreads = 1; iThreads < iCores; iThreads *= 2) threadCounts.push_back(iThreads);
+        threadCounts.push_back(iCores);
+
+        for(unsigned iThreads : threadCounts)
+        {
+            WorkStealingPool pool(iThreads - 1);
+            BatchSimulator simulator(pool);
+            for(BotStrategy strategy : strategies)
+            {
+                SimulationResult result = simulator.run(strategy, iGames);
+                std::cout << "simulate " << BatchSimulator::strategyName(strategy) << " x" << iThreads << " threads: "
+                          << result.winRate() * 100.0 << "% wins, " << result.iGames / result.dSeconds << " games/s, "
+                          << result.gamesPerSecondPerCore() << " games/s/core\n";
+            }
+        }
+    }
+
+    /*********************************************************************
+    void benchParallelManifest()
+    Purpose:
+        Loads a 10M-row generated manifest on pools of 1 to every core,
+        then validates, totals, displays and sorts it on the same pool.
+    *********************************************************************/
+    void benchParallelManifest()
+    {
+        const size_t iRows = 10000000;
+        ScenarioGenerator scenario(2025, iRows, 100);
+        unsigned iCores = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned> threadCounts;
+        for(unsigned iThreads = 1; iThreads < iCores; iThreads *= 2) threadCounts.push_back(iThreads);
+        threadCounts.push_back(iCores);
+
+        double dBaseMs = 0.0;
+        for(unsigned iThreads : threadCounts)
+        {
+            WorkStealingPool pool(iThreads - 1);
+            std::unique_ptr<AirshipOrderList> airshipOrderList(new AirshipOrderList());
+            BenchClock::time_point start = BenchClock::now();
+            scenario.loadInto(*airshipOrderList, pool);
+            double dLoadMs = elapsedMs(start);
+
+            start = BenchClock::now();
+            size_t iInvalid = airshipOrderList->countInvalid(pool);
+            double dValidateMs = elapsedMs(start);
+
+            start = BenchClock::now();
+            ManifestTotals totals = airshipOrderList->totals(pool);
+            double dTotalsMs = elapsedMs(start);
+
+            NullSink sink(64 * 1024);
+            std::ostream out(&sink);
+            start = BenchClock::now();
+            airshipOrderList->displayDeliveries(out, pool);
+            out.flush();
+            double dDisplayMs = elapsedMs(start);
+
+            const DeliverySortKey sortKeys[] = { DeliverySortKey::Customer, DeliverySortKey::Item, DeliverySortKey::Cost };
+            double sortMs[3];
+            for(size_t iKey = 0; iKey < 3; iKey++)
+            {
+                start = BenchClock::now();
+                airshipOrderList->sortBy(sortKeys[iKey], pool);
+                sortMs[iKey] = elapsedMs(start);
+            }
+
+            double dAllMs = dLoadMs + dValidateMs + dTotalsMs + dDisplayMs + sortMs[0] + sortMs[1] + sortMs[2];
+            if(iThreads == 1) dBaseMs = dAllMs;
+            std::cout << "manifest " << iRows << " rows x" << iThreads << " threads: load " << dLoadMs << " ms, validate "
+                      << dValidateMs << " ms (" << iInvalid << " invalid), totals " << dTotalsMs << " ms ("
+                      << totals.iUnits << " units, " << totals.cost << " credits), display " << dDisplayMs
+                      << " ms, sort by customer/item/cost " << sortMs[0] << "/" << sortMs[1] << "/" << sortMs[2]
+                      << " ms; " << dBaseMs / dAllMs << "x\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchLookupMisses()
+    Purpose:
+        Measures findDelivery() on names that are not in the manifest,
+        the usual audit result, against a plain walk of the list.
+    *********************************************************************/
+    void benchLookupMisses()
+    {
+        const size_t manifestSizes[] = { 1000, 100000, 10000000 };
+        for(size_t iRows : manifestSizes)
+        {
+            ScenarioGenerator scenario(7, iRows);
+            std::unique_ptr<AirshipOrderList> airshipOrderList(new AirshipOrderList());
+            scenario.loadInto(*airshipOrderList, WorkStealingPool::shared());
+            size_t iLookups = std::max<size_t>(10, 100000000 / iRows);
+            std::vector<std::string> names;
+            for(size_t i = 0; i < 64; i++) names.push_back("Auditor " + std::to_string(i));
+            const std::string szItem = "Brass Gyroscope";
+
+            size_t iFound = 0;
+            BenchClock::time_point start = BenchClock::now();
+            for(size_t i = 0; i < iLookups; i++) iFound += airshipOrderList->findDelivery(names[i % names.size()], szItem) != nullptr ? 1 : 0;
+            double dTableMs = elapsedMs(start);
+
+            start = BenchClock::now();
+            for(size_t i = 0; i < iLookups; i++)
+            {
+                const std::string& szName = names[i % names.size()];
+                for(const Delivery* current = airshipOrderList->getHead(); current != nullptr; current = current->pNext)
+                {
+                    if(current->szName == szName && current->szItem == szItem)
+                    {
+                        iFound++;
+                        break;
+                    }
+                }
+            }
+            double dWalkMs = elapsedMs(start);
+
+            std::cout << "lookup misses in " << iRows << " rows: fingerprints " << iLookups / (dTableMs / 1000.0) << " lookups/s ("
+                      << dTableMs * 1e6 / (static_cast<double>(iLookups) * iRows) << " ns/node), list walk "
+                      << iLookups / (dWalkMs / 1000.0) << " lookups/s (" << dWalkMs * 1e6 / (static_cast<double>(iLookups) * iRows)
+                      << " ns/node), " << iFound << " found\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchLookupHits()
+    Purpose:
+        Measures findDelivery() on orders near the head and near the
+        tail of the manifest against a list walk that stops at the
+        match. A freshly loaded manifest is in storage order, so the
+        fingerprint scan stops at the match too.
+    *********************************************************************/
+    void benchLookupHits()
+    {
+        const size_t manifestSizes[] = { 1000, 100000, 10000000 };
+        const size_t TARGETS = 64;
+        for(size_t iRows : manifestSizes)
+        {
+            ScenarioGenerator scenario(7, iRows);
+            std::unique_ptr<AirshipOrderList> airshipOrderList(new AirshipOrderList());
+            scenario.loadInto(*airshipOrderList, WorkStealingPool::shared());
+            size_t iLookups = std::max<size_t>(10, 100000000 / iRows);
+
+            ScenarioOrder order;
+            std::vector<std::pair<std::string, std::string>> nearTargets;
+            std::vector<std::pair<std::string, std::string>> farTargets;
+            for(size_t i = 0; i < TARGETS; i++)
+            {
+                scenario.order(i, order);
+                nearTargets.emplace_back(order.szName, std::string(order.szItem));
+                scenario.order(iRows - 1 - i, order);
+                farTargets.emplace_back(order.szName, std::string(order.szItem));
+            }
+
+            std::cout << "lookup hits in " << iRows << " rows:";
+            const char* targetNames[] = { "near head", "near tail" };
+            const std::vector<std::pair<std::string, std::string>>* targetSets[] = { &nearTargets, &farTargets };
+            for(size_t iSet = 0; iSet < 2; iSet++)
+            {
+                const std::vector<std::pair<std::string, std::string>>& targets = *targetSets[iSet];
+                size_t iFound = 0;
+                BenchClock::time_point start = BenchClock::now();
+                for(size_t i = 0; i < iLookups; i++)
+                {
+                    const std::pair<std::string, std::string>& target = targets[i % targets.size()];
+                    iFound += airshipOrderList->findDelivery(target.first, target.second) != nullptr ? 1 : 0;
+                }
+                double dTableMs = elapsedMs(start);
+
+                start = BenchClock::now();
+                for(size_t i = 0; i < iLookups; i++)
+                {
+                    const std::pair<std::string, std::string>& target = targets[i % targets.size()];
+                    for(const Delivery* current = airshipOrderList->getHead(); current != nullptr; current = current->pNext)
+                    {
+                        if(current->szName == target.first && current->szItem == target.second)
+                        {
+                            iFound++;
+                            break;
+                        }
+                    }
+                }
+                double dWalkMs = elapsedMs(start);
+
+                std::cout << (iSet == 0 ? " " : ", ") << targetNames[iSet] << " fingerprints " << dTableMs * 1e6 / iLookups
+                          << " ns, list walk " << dWalkMs * 1e6 / iLookups << " ns (" << iFound << " found)";
+            }
+            std::cout << "\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchSearchIndex()
+    Purpose:
+        Measures DeliverySearchIndex builds and queries: short exact
+        prefixes, long names with two typos, and misses, against a
+        case-folded prefix test on every node of the list.
+    *********************************************************************/
+    void benchSearchIndex()
+    {
+        const size_t manifestSizes[] = { 10000, 1000000, 5000000 };
+        const size_t QUERIES = 2000;
+        for(size_t iRows : manifestSizes)
+        {
+            ScenarioGenerator scenario(11, iRows);
+            std::unique_ptr<AirshipOrderList> airshipOrderList(new AirshipOrderList());
+            scenario.loadInto(*airshipOrderList, WorkStealingPool::shared());
+
+            BenchClock::time_point start = BenchClock::now();
+            DeliverySearchIndex searchIndex(*airshipOrderList);
+            double dBuildMs = elapsedMs(start);
+
+            std::vector<std::string> prefixes;
+            std::vector<std::string> typos;
+            std::vector<std::string> misses;
+            ScenarioOrder order;
+            for(size_t i = 0; i < QUERIES; i++)
+            {
+                scenario.order((i * 7919) % iRows, order);
+                std::string szName = order.szName;
+                prefixes.push_back(szName.substr(0, 3));
+                if(szName.size() > 6)
+                {
+                    szName[1] = (szName[1] == 'x') ? 'y' : 'x';
+                    szName.erase(szName.size() / 2, 1);
+                }
+                typos.push_back(szName);
+                misses.push_back("Qzv" + std::to_string(i));
+            }
+
+            std::vector<SearchHit> hits;
+            double queryUs[3];
+            size_t iHits[3] = { 0, 0, 0 };
+            const std::vector<std::string>* querySets[3] = { &prefixes, &typos, &misses };
+            const size_t maxEdits[3] = { 0, 2, 1 };
+            for(size_t iSet = 0; iSet < 3; iSet++)
+            {
+                start = BenchClock::now();
+                for(const std::string& szQuery : *querySets[iSet]) iHits[iSet] += searchIndex.search(szQuery, maxEdits[iSet], 10, hits);
+                queryUs[iSet] = elapsedMs(start) * 1000.0 / QUERIES;
+            }
+
+            size_t iScans = std::max<size_t>(4, 20000000 / iRows);
+            size_t iWalkHits = 0;
+            start = BenchClock::now();
+            for(size_t i = 0; i < iScans; i++)
+            {
+                const std::string& szQuery = prefixes[i % prefixes.size()];
+                size_t iFound = 0;
+                for(const Delivery* current = airshipOrderList->getHead(); current != nullptr && iFound < 10; current = current->pNext)
+                {
+                    std::string_view szName = current->szName.view();
+                    bool bMatch = szName.size() >= szQuery.size() && std::equal(szQuery.begin(), szQuery.end(), szName.begin(),
+                        [](char cLeft, char cRight) { return std::tolower(static_cast<unsigned char>(cLeft)) == std::tolower(static_cast<unsigned char>(cRight)); });
+                    if(bMatch) iFound++;
+                }
+                iWalkHits += iFound;
+            }
+            double dWalkUs = elapsedMs(start) * 1000.0 / iScans;
+
+            start = BenchClock::now();
+            size_t iMissScanned = 0;
+            for(size_t i = 0; i < iScans; i++)
+            {
+                const std::string& szQuery = misses[i % misses.size()];
+                for(const Delivery* current = airshipOrderList->getHead(); current != nullptr; current = current->pNext)
+                {
+                    iMissScanned += current->szName.view().substr(0, szQuery.size()) == szQuery ? 1 : 0;
+                }
+            }
+            double dMissWalkUs = elapsedMs(start) * 1000.0 / iScans;
+
+            std::cout << "search " << iRows << " rows: index build " << dBuildMs << " ms (" << searchIndex.getTermCount() << " terms, "
+                      << searchIndex.footprintBytes() / (1024 * 1024) << " MiB); prefix " << queryUs[0] << " us, 2-typo name "
+                      << queryUs[1] << " us, miss " << queryUs[2] << " us per query (" << iHits[0] << "/" << iHits[1] << "/" << iHits[2]
+                      << " hits); list walk prefix " << dWalkUs << " us, miss " << dMissWalkUs << " us (" << iWalkHits + iMissScanned
+                      << " hits)\n";
+        }
+    }
+
+    /*********************************************************************
+    void benchCredits()
+    Purpose:
+        Measures Credits formatting against std::fixed doubles, and
+        summing costs as Credits against doubles, with the drift the
+        double sum picks up.
+    *********************************************************************/
+    void benchCredits()
+    {
+        const size_t AMOUNTS = 10000000;
+        const size_t STREAMED = 1000000;
+        std::mt19937_64 random(50);
+        std::vector<Credits> amounts(AMOUNTS);
+        std::vector<double> doubles(AMOUNTS);
+        for(size_t i = 0; i < AMOUNTS; i++)
+        {
+            amounts[i] = Credits::fromCents(static_cast<int64_t>(random() % 100000000));
+            doubles[i] = amounts[i].toDouble();
+        }
+
+        char text[Credits::MAX_FORMATTED];
+        size_t iChars = 0;
+        BenchClock::time_point start = BenchClock::now();
+        for(const Credits& amount : amounts) iChars += static_cast<size_t>(amount.format(text) - text);
+        double dFormatNs = elapsedMs(start) * 1e6 / AMOUNTS;
+
+        std::ostringstream creditsOut;
+        start = BenchClock::now();
+        for(size_t i = 0; i < STREAMED; i++) creditsOut << amounts[i] << '\n';
+        double dCreditsStreamNs = elapsedMs(start) * 1e6 / STREAMED;
+
+        std::ostringstream doublesOut;
+        doublesOut << std::fixed << std::setprecision(2);
+        start = BenchClock::now();
+        for(size_t i = 0; i < STREAMED; i++) doublesOut << doubles[i] << '\n';
+        double dDoubleStreamNs = elapsedMs(start) * 1e6 / STREAMED;
+        bool bSameText = creditsOut.str() == doublesOut.str();
+
+        Credits total;
+        start = BenchClock::now();
+        for(const Credits& amount : amounts) total += amount;
+        double dCreditsSumNs = elapsedMs(start) * 1e6 / AMOUNTS;
+
+        double dTotal = 0.0;
+        start = BenchClock::now();
+        for(double dAmount : doubles) dTotal += dAmount;
+        double dDoubleSumNs = elapsedMs(start) * 1e6 / AMOUNTS;
+        int64_t iDriftCents = Credits::fromDouble(dTotal).cents() - total.cents();
+
+        std::cout << "credits: format " << dFormatNs << " ns (" << iChars / AMOUNTS << " chars avg), ostream " << dCreditsStreamNs
+                  << " ns vs std::fixed double " << dDoubleStreamNs << " ns (" << (bSameText ? "same text" : "TEXT DIFFERS")
+                  << "); sum " << AMOUNTS << " costs " << dCreditsSumNs << " ns vs double " << dDoubleSumNs << " ns per cost, total "
+                  << total << ", double off by " << iDriftCents << " cents\n";
+    }
+
+    /*********************************************************************
+    void benchSessionReplay()
+    Purpose:
+        Records a batch of session transcripts, then measures how many
+        SessionReplayer can regression-test per minute on one thread
+        and fanned out across every core.
+    *********************************************************************/
+    void benchSessionReplay()
+    {
+        const std::string& szScript = scriptedShift();
+        const int iSessions = 2000;
+        std::vector<std::string> paths;
+        for(int i = 0; i < iSessions; i++)
+        {
+            paths.push_back("benchmark_session_" + std::to_string(i) + ".asr");
+            SessionRecorder recorder(paths.back());
+            size_t iLineStart = 0;
+            while(iLineStart < szScript.size())
+            {
+                size_t iLineEnd = szScript.find('\n', iLineStart) + 1;
+                recorder.record(szScript.data() + iLineStart, iLineEnd - iLineStart, 1500000);
+                iLineStart = iLineEnd;
+            }
+        }
+
+        unsigned iCores = std::max(1u, std::thread::hardware_concurrency());
+        const unsigned threadCounts[] = { 1, iCores };
+        for(unsigned iThreads : threadCounts)
+        {
+            BenchClock::time_point start = BenchClock::now();
+            std::vector<ReplayResult> results = SessionReplayer::replayAll(paths, iThreads);
+            double dMs = elapsedMs(start);
+            size_t iVictories = 0;
+            for(const ReplayResult& result : results) iVictories += result.bGuessCorrect ? 1 : 0;
+            std::cout << "replay " << iSessions << " sessions x" << iThreads << " threads: " << dMs << " ms, "
+                      << iSessions * 60000.0 / dMs << " sessions/min (" << iVictories << " victories)\n";
+        }
+
+        for(const std::string& szPath : paths) std::remove(szPath.c_str());
+    }
+
+    /*********************************************************************
+    void benchMultiplexedSessions()
+    Purpose:
+        Drives thousands of sessions from one thread with step(),
+        saving and resuming every session's GameState halfway through.
+    *********************************************************************/
+    void benchMultiplexedSessions()
+    {
+        const size_t iSessions = 10000;
+        static const DisplayManager displayManager;
+        std::vector<std::string> lines;
+        const std::string& szScript = scriptedShift();
+        for(size_t iPos = 0; iPos < szScript.size(); iPos = szScript.find('\n', iPos) + 1)
+        {
+            lines.push_back(szScript.substr(iPos, szScript.find('\n', iPos) - iPos));
+        }
+
+        NullSink sink(4096);
+        std::vector<std::unique_ptr<AirshipOrderList>> manifests;
+        std::vector<std::unique_ptr<GameManager>> sessions;
+        BenchClock::time_point start = BenchClock::now();
+        for(size_t i = 0; i < iSessions; i++)
+        {
+            manifests.emplace_back(new AirshipOrderList());
+            sessions.emplace_back(new GameManager(*manifests.back(), sink));
+            sessions.back()->start(displayManager);
+        }
+
+        size_t iSteps = 0;
+        double dSaveMs = 0.0;
+        size_t iStateBytes = 0;
+        for(size_t iLine = 0; iLine < lines.size(); iLine++)
+        {
+            if(iLine == lines.size() / 2)
+            {
+                BenchClock::time_point saveStart = BenchClock::now();
+                std::vector<std::string> states(iSessions);
+                for(size_t i = 0; i < iSessions; i++)
+                {
+                    sessions[i]->getState().serialize(states[i]);
+                    iStateBytes += states[i].size();
+                    sessions[i].reset();
+                }
+                for(size_t i = 0; i < iSessions; i++)
+                {
+                    GameState state;
+                    GameState::deserialize(states[i], state);
+                    sessions[i].reset(new GameManager(*manifests[i], sink));
+                    sessions[i]->resume(displayManager, state);
+                }
+                dSaveMs = elapsedMs(saveStart);
+            }
+            for(size_t i = 0; i < iSessions; i++)
+            {
+                sessions[i]->step(lines[iLine]);
+                iSteps++;
+            }
+        }
+        double dMs = elapsedMs(start);
+
+        size_t iVictories = 0;
+        for(const std::unique_ptr<GameManager>& session : sessions)
+        {
+            iVictories += (session->isFinished() && session->getIsGuessCorrect()) ? 1 : 0;
+        }
+        std::cout << "multiplex " << iSessions << " sessions on 1 thread: " << dMs << " ms, "
+                  << iSteps / (dMs / 1000.0) << " steps/s, " << iVictories << " victories; save+resume all "
+                  << dSaveMs << " ms at " << iStateBytes / iSessions << " bytes/state\n";
+    }
+
+    /*********************************************************************
+    void benchTracing()
+    Purpose:
+        Plays the scripted shift with and without a TraceRecorder
+        attached to measure what each recorded span costs.
+    *********************************************************************/
+    void benchTracing()
+    {
+        const size_t iSessions = 2000;
+        static const DisplayManager displayManager;
+        std::vector<std::string> lines;
+        const std::string& szScript = scriptedShift();
+        for(size_t iPos = 0; iPos < szScript.size(); iPos = szScript.find('\n', iPos) + 1)
+        {
+            lines.push_back(szScript.substr(iPos, szScript.find('\n', iPos) - iPos));
+        }
+
+        NullSink sink(4096);
+        TraceRecorder tracer(1 << 16);
+        double dMs[2] = {0.0, 0.0};
+        uint64_t iSpans = 0;
+        for(int iTraced = 0; iTraced < 2; iTraced++)
+        {
+            BenchClock::time_point start = BenchClock::now();
+            for(size_t i = 0; i < iSessions; i++)
+            {
+                AirshipOrderList airshipOrderList;
+                GameManager gameManager(airshipOrderList, sink);
+                if(iTraced == 1) gameManager.setTracer(&tracer, static_cast<uint32_t>(i));
+                gameManager.start(displayManager);
+                for(const std::string& szLine : lines) gameManager.step(szLine);
+            }
+            dMs[iTraced] = elapsedMs(start);
+        }
+        iSpans = tracer.size() + tracer.getDropped();
+
+        std::cout << "trace " << iSessions << " shifts: " << dMs[0] << " ms untraced, " << dMs[1] << " ms traced, "
+                  << iSpans / iSessions << " spans/shift, "
+                  << (dMs[1] - dMs[0]) * 1e6 / static_cast<double>(iSpans) << " ns/span\n";
+    }
+
+    /*********************************************************************
+    void benchCoroutineSessions()
+    Purpose:
+        Suspends 100k coroutine sessions in one SessionScheduler,
+        reports what each costs in memory by component, and resumes
+        them line by line to the end of the shift.
+    *********************************************************************/
+    void benchCoroutineSessions()
+    {
+        const size_t iSessions = 100000;
+        static const DisplayManager displayManager;
+        std::vector<std::string> lines;
+        const std::string& szScript = scriptedShift();
+        for(size_t iPos = 0; iPos < szScript.size(); iPos = szScript.find('\n', iPos) + 1)
+        {
+            lines.push_back(szScript.substr(iPos, szScript.find('\n', iPos) - iPos));
+        }
+
+        NullSink sink(4096);
+        SessionScheduler scheduler(displayManager);
+        std::vector<size_t> ids;
+        size_t iHeapBefore = mallinfo2().uordblks;
+        BenchClock::time_point start = BenchClock::now();
+        for(size_t i = 0; i < iSessions; i++)
+        {
+            ids.push_back(scheduler.open(sink));
+        }
+        size_t iHeapOpen = mallinfo2().uordblks - iHeapBefore;
+        SessionFootprint openFootprint = scheduler.getFootprint();
+
+        size_t iHeapMid = 0;
+        SessionFootprint midFootprint;
+        for(size_t iLine = 0; iLine < lines.size(); iLine++)
+        {
+            for(size_t iId : ids) scheduler.deliver(iId, lines[iLine]);
+            scheduler.runReady();
+            if(iLine == lines.size() / 2)
+            {
+                iHeapMid = mallinfo2().uordblks - iHeapBefore;
+                midFootprint = scheduler.getFootprint();
+            }
+        }
+        double dMs = elapsedMs(start);
+
+        size_t iVictories = 0;
+        for(size_t iId : ids)
+        {
+            iVictories += (scheduler.isFinished(iId) && scheduler.getGame(iId).getIsGuessCorrect()) ? 1 : 0;
+            scheduler.release(iId);
+        }
+        std::cout << "coroutines " << iSessions << " sessions: " << dMs << " ms, " << iVictories << " victories, "
+                  << scheduler.getSharedBytes() << " B shared scenes (" << DisplayManager::textBytes()
+                  << " B read-only text)\n";
+        std::cout << "  per session at start: ";
+        openFootprint.print(std::cout, iSessions);
+        std::cout << ", heap " << iHeapOpen / iSessions << " B\n  per session mid-shift: ";
+        midFootprint.print(std::cout, iSessions);
+        std::cout << ", heap " << iHeapMid / iSessions << " B\n";
+    }
+}
+
+/*********************************************************************
+int main()
+Purpose:
+    Runs every benchmark in turn.
+Parameters:
+    None
+Return Value:
+    int - 0 on successful completion
+Notes:
+    Ends with the list operation table when built with INSTRUMENT=1.
+*********************************************************************/
+int main()
+{
+    benchBatchMutations();
+    benchSmallManifests();
+    benchContention();
+    benchIngestQueue();
+    benchManifestLog();
+    benchCheckpoints();
+    benchInputReader();
+    benchOutputSink();
+    benchSceneFormatter();
+    benchScenarios();
+    benchBatchSimulation();
+    benchParallelManifest();
+    benchLookupMisses();
+    benchLookupHits();
+    benchSearchIndex();
+    benchCredits();
+    benchSessionReplay();
+    benchMultiplexedSessions();
+    benchTracing();
+    benchCoroutineSessions();
+    ListInstrumentation::global().writeText(std::cout);
+    return 0;
+}
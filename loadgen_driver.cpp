@@ -0,0 +1,337 @@
+/*********************************************************************
+File name: loadgen_driver.cpp
+Author: <Luke Lyons>(<ujw18>)
+Date: 11/14/2025
+
+Purpose:
+    Load generator for the session server started with --serve or
+    --serve-tcp.
+Command Parameters:
+    --unix <path>        Connect to a UNIX socket
+    --tcp <port>         Connect to a loopback TCP port
+    --connections <n>    Shifts to play in total (default 1000)
+    --concurrency <n>    Connections open at once (default 100)
+Input:
+    None
+Results:
+    Prints connections handled, throughput and response latency
+    percentiles to standard output.
+Notes:
+    Each connection plays a full winning shift one line at a time and
+    waits for the whole response before sending the next line. The
+    size of every response is worked out beforehand by stepping a
+    local GameManager through the same script, so a response is
+    complete exactly when that many bytes have arrived. Build with
+    "make loadgen".
+*********************************************************************/
+
+#include "AirshipOrderList.hpp"
+#include "DisplayManager.hpp"
+#include "GameManager.hpp"
+#include "OutputSink.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock LoadClock;
+
+    const char* SHIFT_SCRIPT =
+        "\n"
+        "Bulk Ryker\nProtein Infusion Canisters\n4\n200\n\n"
+        "Buck Hawthorne\nClassic Ale Keg\n1\n90\n\n"
+        "Old Man Ripple\nNet-Stabilizer Kit\n2\n120\n\n"
+        "Bramble Nett\nCultivation Spore Beds\n3\n150\n\n"
+        "Vesper Morrow\nEM Field Sensor\n1\n110\n\n"
+        "Linton Yarrow\nSoft-Code Debugging Array\n1\n320\n\n"
+        "4\n\n3\nBulk Ryker\nProtein Infusion Canisters\n5\n250\n\n"
+        "2\nBulk Ryker\nProtein Infusion Canisters\n\n"
+        "5\nLinton Yarrow\nSoft-Code Debugging Array\ny\n\n";
+
+    /*********************************************************************
+    Class Name: ByteCountSink
+    Purpose:
+        Sink that only counts how many bytes it was given.
+    *********************************************************************/
+    class ByteCountSink : public OutputSink
+    {
+        private:
+            size_t iBytes = 0;   // Bytes written so far
+
+        protected:
+            bool writeOut(const char* pData, size_t iLength) override { (void)pData; iBytes += iLength; return true; }
+
+        public:
+            ByteCountSink() : OutputSink(0) {}
+            size_t getBytes() const { return iBytes; }
+    };
+
+    /*********************************************************************
+    Struct Name: ClientConnection
+    Purpose:
+        One simulated dock terminal.
+    *********************************************************************/
+    struct ClientConnection
+    {
+        int iFd = -1;                          // Socket
+        size_t iNextLine = 0;                  // Next script line to send
+        size_t iAwaiting = 0;                  // Bytes still due for the current response
+        bool bConnected = false;               // Non-blocking connect has finished
+        LoadClock::time_point sentAt;          // When the current line was sent
+    };
+
+    /*********************************************************************
+    std::vector<size_t> expectedResponses(const std::vector<std::string>& lines)
+    Purpose:
+        Steps a local game through the script and records the size of
+        each response; element 0 is the opening screen.
+    *********************************************************************/
+    std::vector<size_t> expectedResponses(const std::vector<std::string>& lines)
+    {
+        DisplayManager displayManager;
+        AirshipOrderList airshipOrderList;
+        ByteCountSink sink;
+        GameManager gameManager(airshipOrderList, sink);
+
+        std::vector<size_t> sizes;
+        gameManager.start(displayManager);
+        sizes.push_back(sink.getBytes());
+        for(const std::string& szLine : lines)
+        {
+            size_t iBefore = sink.getBytes();
+            gameManager.step(szLine);
+            sizes.push_back(sink.getBytes() - iBefore);
+        }
+        return sizes;
+    }
+
+    /*********************************************************************
+    int openSocket(const std::string& szUnixPath, int iTcpPort)
+    Purpose:
+        Starts a non-blocking connect to the server.
+    *********************************************************************/
+    int openSocket(const std::string& szUnixPath, int iTcpPort)
+    {
+        int iFd;
+        int iResult;
+        if(!szUnixPath.empty())
+        {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, szUnixPath.c_str(), sizeof(address.sun_path) - 1);
+            iFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if(iFd < 0) return -1;
+            iResult = ::connect(iFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        }
+        else
+        {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(static_cast<uint16_t>(iTcpPort));
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            iFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if(iFd < 0) return -1;
+            int iNoDelay = 1;
+            ::setsockopt(iFd, IPPROTO_TCP, TCP_NODELAY, &iNoDelay, sizeof(iNoDelay));
+            iResult = ::connect(iFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        }
+        if(iResult != 0 && errno != EINPROGRESS && errno != EAGAIN)
+        {
+            ::close(iFd);
+            return -1;
+        }
+        return iFd;
+    }
+
+    /*********************************************************************
+    double percentile(std::vector<double>& samples, double dFraction)
+    Purpose:
+        Returns the requested percentile of samples (reorders them).
+    *********************************************************************/
+    double percentile(std::vector<double>& samples, double dFraction)
+    {
+        if(samples.empty()) return 0.0;
+        size_t iIndex = std::min(samples.size() - 1, static_cast<size_t>(dFraction * samples.size()));
+        std::nth_element(samples.begin(), samples.begin() + iIndex, samples.end());
+        return samples[iIndex];
+    }
+}
+
+/*********************************************************************
+int main(int argc, char* argv[])
+Purpose:
+    Plays many shifts against a running session server and reports
+    latency.
+Parameters:
+    I int argc - Number of command line arguments
+    I char* argv[] - Command line arguments
+Return Value:
+    int - 0 if every shift completed, 1 otherwise
+Notes:
+    A connection that sees more bytes than expected, or none for five
+    seconds, is counted as failed.
+*********************************************************************/
+int main(int argc, char* argv[])
+{
+    std::string szUnixPath;
+    int iTcpPort = 0;
+    size_t iTotal = 1000;
+    size_t iConcurrency = 100;
+    for(int i = 1; i + 1 < argc; i++)
+    {
+        std::string szArg = argv[i];
+        if(szArg == "--unix") szUnixPath = argv[++i];
+        else if(szArg == "--tcp") iTcpPort = std::atoi(argv[++i]);
+        else if(szArg == "--connections") iTotal = std::strtoul(argv[++i], nullptr, 10);
+        else if(szArg == "--concurrency") iConcurrency = std::strtoul(argv[++i], nullptr, 10);
+    }
+    if(szUnixPath.empty() && iTcpPort <= 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " --unix <path> | --tcp <port> [--connections n] [--concurrency n]\n";
+        return 1;
+    }
+
+    std::vector<std::string> lines;
+    std::string szScript = SHIFT_SCRIPT;
+    for(size_t iPos = 0; iPos < szScript.size(); iPos = szScript.find('\n', iPos) + 1)
+    {
+        lines.push_back(szScript.substr(iPos, szScript.find('\n', iPos) - iPos + 1));
+    }
+    std::vector<std::string> stepLines;
+    for(const std::string& szLine : lines) stepLines.push_back(szLine.substr(0, szLine.size() - 1));
+    const std::vector<size_t> responseBytes = expectedResponses(stepLines);
+
+    int iEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    std::unordered_map<int, ClientConnection> clients;
+    std::vector<double> latenciesUs;
+    size_t iStarted = 0;
+    size_t iCompleted = 0;
+    size_t iFailed = 0;
+
+    auto startClient = [&]()
+    {
+        int iFd = openSocket(szUnixPath, iTcpPort);
+        iStarted++;
+        if(iFd < 0)
+        {
+            iFailed++;
+            return;
+        }
+        ClientConnection client;
+        client.iFd = iFd;
+        client.iAwaiting = responseBytes[0];
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.fd = iFd;
+        ::epoll_ctl(iEpollFd, EPOLL_CTL_ADD, iFd, &event);
+        clients[iFd] = client;
+    };
+    auto finishClient = [&](int iFd, bool bOk)
+    {
+        ::epoll_ctl(iEpollFd, EPOLL_CTL_DEL, iFd, nullptr);
+        ::close(iFd);
+        clients.erase(iFd);
+        (bOk ? iCompleted : iFailed)++;
+    };
+
+    LoadClock::time_point start = LoadClock::now();
+    while(iStarted < iTotal && clients.size() < iConcurrency) startClient();
+
+    const int MAX_EVENTS = 256;
+    epoll_event events[MAX_EVENTS];
+    char buffer[64 * 1024];
+    while(!clients.empty())
+    {
+        int iReady = ::epoll_wait(iEpollFd, events, MAX_EVENTS, 5000);
+        if(iReady < 0 && errno == EINTR) continue;
+        if(iReady <= 0)
+        {
+            std::cerr << "Stalled with " << clients.size() << " connections waiting\n";
+            while(!clients.empty()) finishClient(clients.begin()->first, false);
+            break;
+        }
+
+        for(int i = 0; i < iReady; i++)
+        {
+            int iFd = events[i].data.fd;
+            auto found = clients.find(iFd);
+            if(found == clients.end()) continue;
+            ClientConnection& client = found->second;
+            client.bConnected = true;
+
+            bool bDone = false;
+            bool bOk = true;
+            while(!bDone)
+            {
+                ssize_t iRead = ::read(iFd, buffer, sizeof(buffer));
+                if(iRead < 0)
+                {
+                    if(errno == EINTR) continue;
+                    if(errno != EAGAIN && errno != EWOULDBLOCK) { bDone = true; bOk = false; }
+                    break;
+                }
+                if(iRead == 0)
+                {
+                    bDone = true;
+                    bOk = (client.iNextLine == lines.size() && client.iAwaiting == 0);
+                    break;
+                }
+                if(static_cast<size_t>(iRead) > client.iAwaiting)
+                {
+                    bDone = true;
+                    bOk = false;
+                    break;
+                }
+                client.iAwaiting -= static_cast<size_t>(iRead);
+                if(client.iAwaiting > 0) continue;
+
+                if(client.iNextLine > 0)
+                {
+                    latenciesUs.push_back(std::chrono::duration<double, std::micro>(LoadClock::now() - client.sentAt).count());
+                }
+                if(client.iNextLine == lines.size()) continue;
+
+                const std::string& szLine = lines[client.iNextLine];
+                client.sentAt = LoadClock::now();
+                if(::send(iFd, szLine.data(), szLine.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(szLine.size()))
+                {
+                    bDone = true;
+                    bOk = false;
+                    break;
+                }
+                client.iNextLine++;
+                client.iAwaiting = responseBytes[client.iNextLine];
+            }
+
+            if(bDone)
+            {
+                finishClient(iFd, bOk);
+                if(iStarted < iTotal) startClient();
+            }
+        }
+    }
+    double dSeconds = std::chrono::duration<double>(LoadClock::now() - start).count();
+    ::close(iEpollFd);
+
+    std::cout << "connections handled: " << iCompleted << " of " << iTotal << " (" << iFailed << " failed)\n";
+    std::cout << "responses: " << latenciesUs.size() << " in " << dSeconds << " s, "
+              << latenciesUs.size() / dSeconds << " responses/s\n";
+    std::cout << "latency: p50 " << percentile(latenciesUs, 0.50) << " us, p99 " << percentile(latenciesUs, 0.99)
+              << " us, max " << percentile(latenciesUs, 1.0) << " us\n";
+    return iFailed == 0 ? 0 : 1;
+}
@@ -7,7 +7,27 @@ Purpose:
     Main driver program for the Airship Delivery System game.
     Manages game flow from start to end.
 Command Parameters:
-    None
+    --wal <path>     Log manifest changes to <path> and recover from it,
+                     checkpointing to <path>.checkpoint
+    --record <path>  Save every player input to a session transcript,
+                     along with the --scenario being played (not
+                     allowed with --wal, whose recovered manifest a
+                     transcript cannot hold)
+    --replay <path>  Play a transcript back at full speed, on the
+                     shift it was recorded against; given more than
+                     once, replay them all in parallel and print each
+                     outcome instead of playing
+    --serve <path>   Host a session per connection on a UNIX socket
+    --serve-tcp <port>  Same, on a loopback TCP port
+    --list-stats <path> Write manifest operation statistics as JSON on
+                     exit (needs a "make INSTRUMENT=1" build)
+    --trace <path>   Record scene, parse, list and output spans and
+                     write them as Chrome trace JSON when the shift or
+                     server ends
+    --scenario <seed> Play a generated shift instead of the written one
+    --customers <n>  Customers in a generated shift (default 6)
+    --simulate <games> Play that many generated shifts with each bot
+                     strategy on every core and print win rates
 Input:
     User input throughout game execution.
 Results:
@@ -17,46 +37,339 @@ Notes:
 *********************************************************************/
 
 #include "AirshipOrderList.hpp"
+#include "BatchSimulator.hpp"
 #include "DisplayManager.hpp"
 #include "GameManager.hpp"
+#include "ListInstrumentation.hpp"
+#include "ManifestCheckpointer.hpp"
+#include "ManifestLog.hpp"
+#include "ScenarioGenerator.hpp"
+#include "SessionRecorder.hpp"
+#include "SessionReplayer.hpp"
+#include "SessionServer.hpp"
+#include "TraceRecorder.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 #include <cstdlib>
+#include <csignal>
 
 /*********************************************************************
-int main()
+int runRegression(const std::vector<std::string>& paths)
 Purpose:
-    Main entry point for the Airship Delivery System game.
+    Replays many session transcripts in parallel and prints the
+    outcome and output digest of each.
+Parameters:
+    I const std::vector<std::string>& paths - Transcripts to replay
+Return Value:
+    int - 0 if every transcript loaded, 1 otherwise
+Notes:
+    Digests can be diffed between builds to catch output changes.
+*********************************************************************/
+int runRegression(const std::vector<std::string>& paths)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<ReplayResult> results = SessionReplayer::replayAll(paths);
+    double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int iFailures = 0;
+    for(const ReplayResult& result : results)
+    {
+        if(!result.bLoaded)
+        {
+            std::cout << result.szPath << ": unreadable transcript\n";
+            iFailures++;
+            continue;
+        }
+        std::cout << result.szPath << ": " << (result.bGuessCorrect ? "victory" : "defeat") << ", "
+                  << result.iDeliveries << " deliveries, output " << std::hex << std::setw(16)
+                  << std::setfill('0') << result.iOutputDigest << std::dec << std::setfill(' ') << "\n";
+    }
+    std::cout << "Replayed " << results.size() << " sessions in " << dSeconds << " s\n";
+    return iFailures == 0 ? 0 : 1;
+}
+
+/*********************************************************************
+int runSimulation(size_t iGames, size_t iCustomers, uint64_t iSeed)
+Purpose:
+    Plays a batch of generated shifts with every bot strategy and
+    prints how often each one wins.
 Parameters:
-    None
+    I size_t iGames - Shifts per strategy
+    I size_t iCustomers - Customers per shift
+    I uint64_t iSeed - Seed of the first shift
 Return Value:
     int - 0 on successful completion
+Notes:
+    Runs on the shared work-stealing pool.
+*********************************************************************/
+int runSimulation(size_t iGames, size_t iCustomers, uint64_t iSeed)
+{
+    BatchSimulator simulator(WorkStealingPool::shared(), iCustomers, iSeed);
+    const BotStrategy strategies[] = { BotStrategy::Random, BotStrategy::CheapestPerUnit, BotStrategy::ClueFollowing };
+    for(BotStrategy strategy : strategies)
+    {
+        SimulationResult result = simulator.run(strategy, iGames);
+        std::cout << std::left << std::setw(18) << BatchSimulator::strategyName(strategy) << std::right
+                  << " won " << std::fixed << std::setprecision(1) << result.winRate() * 100.0 << "% of "
+                  << result.iGames << " shifts, " << std::setprecision(0) << result.gamesPerSecondPerCore()
+                  << " games/s/core on " << result.iThreads << " threads\n";
+    }
+    return 0;
+}
+
+namespace
+{
+    SessionServer* pRunningServer = nullptr;   // Server stopped by SIGINT/SIGTERM
+    std::string szListStatsPath;               // Where writeListStats() puts its JSON
+
+    /*********************************************************************
+    void writeListStats()
+    Purpose:
+        Exit handler that dumps the manifest operation statistics.
+    *********************************************************************/
+    void writeListStats()
+    {
+        std::ofstream statsFile(szListStatsPath);
+        if(!statsFile)
+        {
+            std::cerr << "Unable to write list statistics to " << szListStatsPath << "\n";
+            return;
+        }
+        ListInstrumentation::global().writeJson(statsFile);
+    }
+
+    /*********************************************************************
+    void writeTrace(const TraceRecorder& tracer, const std::string& szPath)
+    Purpose:
+        Saves recorded spans as Chrome trace JSON and prints where the
+        time went to standard error.
+    *********************************************************************/
+    void writeTrace(const TraceRecorder& tracer, const std::string& szPath)
+    {
+        std::ofstream traceFile(szPath);
+        if(!traceFile)
+        {
+            std::cerr << "Unable to write trace to " << szPath << "\n";
+            return;
+        }
+        tracer.writeChromeJson(traceFile);
+        std::cerr << "Trace written to " << szPath << ": ";
+        tracer.writeSummary(std::cerr);
+    }
+
+    /*********************************************************************
+    void stopServer(int iSignal)
+    Purpose:
+        Signal handler that asks the running server to return.
+    *********************************************************************/
+    void stopServer(int iSignal)
+    {
+        (void)iSignal;
+        if(pRunningServer != nullptr) pRunningServer->stop();
+    }
+}
+
+/*********************************************************************
+int runServer(const std::string& szUnixPath, int iTcpPort, TraceRecorder* pTracer)
+Purpose:
+    Hosts game sessions over a socket until interrupted.
+Parameters:
+    I const std::string& szUnixPath - UNIX socket path, empty for TCP
+    I int iTcpPort - Loopback TCP port when szUnixPath is empty
+    I/O TraceRecorder* pTracer - Records every session's spans, or nullptr
+Return Value:
+    int - 0 after a clean shutdown, 1 if the socket cannot be opened
+Notes:
+    Server sessions are in memory only; --wal and --record do not
+    apply to them.
+*********************************************************************/
+int runServer(const std::string& szUnixPath, int iTcpPort, TraceRecorder* pTracer)
+{
+    DisplayManager displayManager;
+    SessionServer server(displayManager);
+    server.setTracer(pTracer);
+    bool bListening = szUnixPath.empty() ? server.listenTcp(static_cast<uint16_t>(iTcpPort))
+                                         : server.listenUnix(szUnixPath);
+    if(!bListening)
+    {
+        std::cerr << "Unable to listen on " << (szUnixPath.empty() ? "port " + std::to_string(iTcpPort) : szUnixPath) << "\n";
+        return 1;
+    }
+
+    pRunningServer = &server;
+    std::signal(SIGINT, stopServer);
+    std::signal(SIGTERM, stopServer);
+    std::cerr << "Serving sessions on " << (szUnixPath.empty() ? "127.0.0.1:" + std::to_string(iTcpPort) : szUnixPath) << "\n";
+    server.run();
+    pRunningServer = nullptr;
+
+    std::cerr << "Served " << server.getAcceptedCount() << " connections, "
+              << server.getCompletedCount() << " shifts completed\n";
+    return 0;
+}
+
+/*********************************************************************
+int main(int argc, char* argv[])
+Purpose:
+    Main entry point for the Airship Delivery System game.
+Parameters:
+    I int argc - Number of command line arguments
+    I char* argv[] - Command line arguments
+Return Value:
+    int - 0 on successful completion, 1 if a file cannot be opened
 Notes:
     Initializes game objects and runs through all scenes in sequence.
+    With --wal, deliveries recovered from the checkpoint and log skip
+    their customer scenes, and both are discarded once the shift ends.
 *********************************************************************/
-int main()
+int main(int argc, char* argv[])
 {
+    std::string szLogPath;
+    std::string szRecordPath;
+    std::vector<std::string> replayPaths;
+    std::string szServePath;
+    int iServePort = 0;
+    std::string szTracePath;
+    std::unique_ptr<ScenarioGenerator> scenario;
+    uint64_t iScenarioSeed = 0;
+    bool bHasScenario = false;
+    size_t iScenarioCustomers = 6;
+    size_t iSimulatedGames = 0;
+
+    for(int i = 1; i < argc; i++)
+    {
+        std::string szArg = argv[i];
+        if(szArg == "--wal" && i + 1 < argc) szLogPath = argv[++i];
+        else if(szArg == "--record" && i + 1 < argc) szRecordPath = argv[++i];
+        else if(szArg == "--replay" && i + 1 < argc) replayPaths.push_back(argv[++i]);
+        else if(szArg == "--serve" && i + 1 < argc) szServePath = argv[++i];
+        else if(szArg == "--serve-tcp" && i + 1 < argc) iServePort = std::atoi(argv[++i]);
+        else if(szArg == "--list-stats" && i + 1 < argc) szListStatsPath = argv[++i];
+        else if(szArg == "--trace" && i + 1 < argc) szTracePath = argv[++i];
+        else if(szArg == "--scenario" && i + 1 < argc)
+        {
+            iScenarioSeed = std::strtoull(argv[++i], nullptr, 10);
+            bHasScenario = true;
+        }
+        else if(szArg == "--customers" && i + 1 < argc) iScenarioCustomers = std::strtoull(argv[++i], nullptr, 10);
+        else if(szArg == "--simulate" && i + 1 < argc) iSimulatedGames = std::strtoull(argv[++i], nullptr, 10);
+    }
+
+    if(!szListStatsPath.empty())
+    {
+        if(!ListInstrumentation::isEnabled()) std::cerr << "Warning: built without INSTRUMENT=1, list statistics will be empty\n";
+        ListInstrumentation::global();   // Constructed first so it outlives the exit handler
+        std::atexit(writeListStats);
+    }
+
+    std::unique_ptr<TraceRecorder> tracer;
+    if(!szTracePath.empty())
+    {
+        const size_t TRACE_SPANS = 1 << 20;
+        tracer.reset(new TraceRecorder(TRACE_SPANS));
+    }
+
+    if(!szServePath.empty() || iServePort > 0)
+    {
+        int iResult = runServer(szServePath, iServePort, tracer.get());
+        if(tracer != nullptr) writeTrace(*tracer, szTracePath);
+        return iResult;
+    }
+
+    if(iSimulatedGames > 0)
+    {
+        return runSimulation(iSimulatedGames, iScenarioCustomers, bHasScenario ? iScenarioSeed : 1);
+    }
+
+    if(replayPaths.size() > 1)
+    {
+        return runRegression(replayPaths);
+    }
+
+    if(!szRecordPath.empty() && !szLogPath.empty())
+    {
+        std::cerr << "--record cannot be combined with --wal: a transcript does not hold the recovered manifest\n";
+        return 1;
+    }
+
+    size_t iScenarioFrauds = 1;
+    std::unique_ptr<InputReader> replayInput;
+    if(replayPaths.size() == 1)
+    {
+        SessionTranscript transcript;
+        if(!SessionReplayer::load(replayPaths[0], transcript))
+        {
+            std::cerr << "Unable to read session transcript " << replayPaths[0] << "\n";
+            return 1;
+        }
+        replayInput.reset(new InputReader(transcript.toScript()));
+        bHasScenario = transcript.setup.iScenarioCustomers > 0;
+        iScenarioSeed = transcript.setup.iScenarioSeed;
+        iScenarioCustomers = transcript.setup.iScenarioCustomers;
+        iScenarioFrauds = transcript.setup.iScenarioFrauds;
+    }
+    InputReader& input = replayInput != nullptr ? *replayInput : InputReader::standardInput();
+
+    SessionSetup setup;
+    if(bHasScenario)
+    {
+        scenario.reset(new ScenarioGenerator(iScenarioSeed, iScenarioCustomers, iScenarioFrauds));
+        setup.iScenarioSeed = scenario->getSeed();
+        setup.iScenarioCustomers = scenario->size();
+        setup.iScenarioFrauds = scenario->getFraudulent().size();
+    }
+
+    std::unique_ptr<SessionRecorder> recorder;
+    if(!szRecordPath.empty())
+    {
+        recorder.reset(new SessionRecorder(szRecordPath, setup));
+        if(!recorder->isOpen())
+        {
+            std::cerr << "Unable to open session transcript " << szRecordPath << "\n";
+            return 1;
+        }
+        input.setRecorder(recorder.get());
+    }
+
     AirshipOrderList airshipOrderList;
     DisplayManager displayManager;
-    GameManager gameManager(airshipOrderList);
+    GameManager gameManager(airshipOrderList, input);
+    gameManager.setTracer(tracer.get());
+    gameManager.setScenario(scenario.get());
+    std::unique_ptr<ManifestLog> manifestLog;
+    std::unique_ptr<ManifestCheckpointer> checkpointer;
+    const int CHECKPOINT_INTERVAL_MS = 5000;
 
-    gameManager.runStartingScene(displayManager.getStartingScene());
-    gameManager.runCustomerScene(displayManager.getCustomerOne());
-    gameManager.runCustomerScene(displayManager.getCustomerTwo());
-    gameManager.runCustomerScene(displayManager.getCustomerThree());
-    gameManager.runCustomerScene(displayManager.getCustomerFour());
-    gameManager.runCustomerScene(displayManager.getCustomerFive());
-    gameManager.runCustomerScene(displayManager.getCustomerSix());
-    gameManager.runGuessingScene(displayManager.getGuessingScene());
-
-    if(gameManager.getIsGuessCorrect() == true)
+    if(!szLogPath.empty())
     {
-        gameManager.runEndingScene(displayManager.getVictoryScene());
+        std::string szCheckpointPath = szLogPath + ".checkpoint";
+        uint64_t iLastLsn = 0;
+        ManifestCheckpointer::recover(szLogPath, szCheckpointPath, airshipOrderList, &iLastLsn);
+        manifestLog.reset(new ManifestLog(szLogPath));
+        if(!manifestLog->isOpen())
+        {
+            std::cerr << "Unable to open manifest log " << szLogPath << "\n";
+            return 1;
+        }
+        manifestLog->advanceLsn(iLastLsn);
+        checkpointer.reset(new ManifestCheckpointer(*manifestLog, szCheckpointPath, CHECKPOINT_INTERVAL_MS));
+        gameManager.setManifestLog(manifestLog.get());
     }
-    else
+
+    size_t iRecovered = airshipOrderList.size();
+    if(iRecovered > 0)
     {
-        gameManager.runEndingScene(displayManager.getLosingScene());
+        std::cout << "Recovered " << iRecovered << " deliveries from the manifest log.\n" << std::flush;
     }
+    gameManager.runShift(displayManager, iRecovered);
+    if(tracer != nullptr) writeTrace(*tracer, szTracePath);
 
+    input.setRecorder(nullptr);
+    if(checkpointer != nullptr) checkpointer->discard();
     return 0;
 }